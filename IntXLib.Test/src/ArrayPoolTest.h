@@ -0,0 +1,82 @@
+#define BOOST_TEST_MODULE ArrayPoolTest
+
+#include "../IntX.h"
+#include "../Utils/ArrayPool.h"
+#include "../Utils/Constants.h"
+#include <vector>
+#include <cstdlib>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ArrayPoolTest)
+
+const UInt32 PooledLength = 1U << Constants::MinPooledArraySizeLog2;
+
+vector<UInt32> GetRandomDigits(const UInt32 length)
+{
+	vector<UInt32> digits(length);
+	for (UInt32 i = 0; i < digits.size(); ++i)
+	{
+		digits[i] = (UInt32)rand() << 16 ^ (UInt32)rand();
+	} // end for
+	digits[length - 1] |= 1U;
+	return digits;
+} // end function GetRandomDigits
+
+BOOST_AUTO_TEST_CASE(ReuseArray)
+{
+	UInt32 *array = ArrayPool<UInt32>::GetArray(PooledLength);
+	ArrayPool<UInt32>::AddArray(array, PooledLength);
+
+	// Any length of the same size class must get the same array back
+	UInt32 *array2 = ArrayPool<UInt32>::GetArray(PooledLength / 2 + 1);
+	BOOST_CHECK(array == array2);
+	ArrayPool<UInt32>::AddArray(array2, PooledLength / 2 + 1);
+}
+
+BOOST_AUTO_TEST_CASE(PooledArrayClear)
+{
+	{
+		PooledArray<UInt32> array(PooledLength);
+		for (UInt32 i = 0; i < array.size(); ++i)
+		{
+			array[i] = 0xFFFFFFFF;
+		} // end for
+	}
+
+	PooledArray<UInt32> array(PooledLength);
+	bool allZero = true;
+	for (UInt32 i = 0; i < array.size(); ++i)
+	{
+		allZero = allZero && array[i] == 0;
+	} // end for
+	BOOST_CHECK(allZero);
+}
+
+BOOST_AUTO_TEST_CASE(PooledArraySwap)
+{
+	PooledArray<UInt32> array(PooledLength), array2(16);
+	UInt32 *ptr = array.data(), *ptr2 = array2.data();
+
+	array.swap(array2);
+	BOOST_CHECK(array.data() == ptr2 && array.size() == 16);
+	BOOST_CHECK(array2.data() == ptr && array2.size() == PooledLength);
+}
+
+BOOST_AUTO_TEST_CASE(NewtonDivideCompareWithClassic)
+{
+	srand(7);
+	for (UInt32 i = 0; i < 2; ++i)
+	{
+		IntX x = IntX(GetRandomDigits(Constants::AutoNewtonLengthLowerBound * 2 + 117), false);
+		IntX x2 = IntX(GetRandomDigits(Constants::AutoNewtonLengthLowerBound + 31), false);
+
+		IntX classicMod, fastMod;
+		IntX classic = IntX::DivideModulo(x, x2, classicMod, DivideMode::dmClassic);
+		IntX fast = IntX::DivideModulo(x, x2, fastMod, DivideMode::dmAutoNewton);
+
+		BOOST_CHECK(classic == fast);
+		BOOST_CHECK(classicMod == fastMod);
+	} // end for
+}
+
+BOOST_AUTO_TEST_SUITE_END()
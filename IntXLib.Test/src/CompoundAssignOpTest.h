@@ -0,0 +1,103 @@
+#define BOOST_TEST_MODULE CompoundAssignOpTest
+
+#include "../IntX.h"
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(CompoundAssignOpTest)
+
+vector<IntX> GetValues()
+{
+	return { IntX(), IntX(1), IntX(-1), IntX("0xFFFFFFFF"), IntX("-18446744073709551615"),
+		IntX("1234567890123456789012345678901234567890"), IntX("-1234567890123456789012345678901234567890") };
+} // end function GetValues
+
+BOOST_AUTO_TEST_CASE(CompareWithBinary)
+{
+	vector<IntX> values = GetValues();
+	for (const IntX &int1 : values)
+	{
+		for (const IntX &int2 : values)
+		{
+			IntX int3 = int1;
+			BOOST_CHECK((int3 += int2) == int1 + int2);
+			int3 = int1;
+			BOOST_CHECK((int3 -= int2) == int1 - int2);
+			int3 = int1;
+			BOOST_CHECK((int3 *= int2) == int1 * int2);
+			int3 = int1;
+			BOOST_CHECK((int3 |= int2) == (int1 | int2));
+			int3 = int1;
+			BOOST_CHECK((int3 &= int2) == (int1 & int2));
+			int3 = int1;
+			BOOST_CHECK((int3 ^= int2) == (int1 ^ int2));
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(SameObject)
+{
+	vector<IntX> values = GetValues();
+	for (const IntX &int1 : values)
+	{
+		IntX int2 = int1;
+		BOOST_CHECK((int2 += int2) == int1 * 2);
+		int2 = int1;
+		BOOST_CHECK((int2 -= int2) == 0);
+		int2 = int1;
+		BOOST_CHECK((int2 *= int2) == int1 * int1);
+		int2 = int1;
+		BOOST_CHECK((int2 |= int2) == int1);
+		int2 = int1;
+		BOOST_CHECK((int2 &= int2) == int1);
+		int2 = int1;
+		BOOST_CHECK((int2 ^= int2) == 0);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(ReturnsReference)
+{
+	IntX int1 = 5;
+	(int1 += 3) *= 2;
+	BOOST_CHECK(int1 == 16);
+
+	IntX &int2 = (int1 <<= 100);
+	BOOST_CHECK(&int2 == &int1);
+	BOOST_CHECK((int1 >>= 100) == 16);
+}
+
+BOOST_AUTO_TEST_CASE(BufferReuse)
+{
+	// Result buffer shrinks and grows here, garbage after the last digit must not leak into results
+	IntX int1 = IntX("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF");
+	int1 -= IntX("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE");
+	BOOST_CHECK(int1 == 1);
+	int1 |= IntX("0x100000000000000000000");
+	BOOST_CHECK(int1 == IntX("0x100000000000000000001"));
+	int1 -= IntX("0x100000000000000000000");
+	int1 ^= IntX("0x100000000000000000000");
+	BOOST_CHECK(int1 == IntX("0x100000000000000000001"));
+
+	IntX int2 = 1, int3 = 1;
+	for (int i = 1; i < 300; i++)
+	{
+		int2 *= IntX("0xFFFFFFFFFFFFFFFFFFFF") + i;
+		int3 = int3 * (IntX("0xFFFFFFFFFFFFFFFFFFFF") + i);
+		int2 >>= 3;
+		int3 = int3 >> 3;
+	} // end for
+	BOOST_CHECK(int2 == int3);
+}
+
+BOOST_AUTO_TEST_CASE(Factorial)
+{
+	IntX int1 = 1;
+	for (int i = 2; i <= 30; i++)
+	{
+		int1 = int1 * i;
+	} // end for
+	BOOST_CHECK(IntX::Factorial(30) == int1);
+	BOOST_CHECK(IntX::Factorial(0) == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+#define BOOST_TEST_MODULE CopyOnWriteTest
+
+#include "../IntX.h"
+#include <vector>
+#include <map>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(CopyOnWriteTest)
+
+BOOST_AUTO_TEST_CASE(SharedStorage)
+{
+	DigitsVector digits1(DigitsVector::InlineCount * 2);
+	digits1[0] = 1;
+
+	DigitsVector digits2 = digits1;
+	DigitsVector digits3;
+	digits3 = digits2;
+#ifdef INTX_COPY_ON_WRITE
+	BOOST_CHECK(digits1.IsShared());
+	BOOST_CHECK(static_cast<const DigitsVector &>(digits2).data() == static_cast<const DigitsVector &>(digits1).data());
+#endif
+
+	digits2[0] = 2;
+	digits3.resize(DigitsVector::InlineCount * 2 + 1);
+	BOOST_CHECK(!digits2.IsShared());
+	BOOST_CHECK(!digits3.IsShared());
+	BOOST_CHECK(!digits1.IsShared());
+	BOOST_CHECK(digits1[0] == 1);
+	BOOST_CHECK(digits2[0] == 2);
+	BOOST_CHECK(digits3[0] == 1);
+	BOOST_CHECK(digits3[DigitsVector::InlineCount * 2] == 0);
+}
+
+BOOST_AUTO_TEST_CASE(SharedStorageShrink)
+{
+	DigitsVector digits1(DigitsVector::InlineCount * 2);
+	digits1[DigitsVector::InlineCount] = 5;
+
+	DigitsVector digits2 = digits1;
+	digits2.resize(1);
+	digits2.shrink_to_fit();
+	digits2.resize(DigitsVector::InlineCount * 2);
+	BOOST_CHECK(digits2[DigitsVector::InlineCount] == 0);
+	BOOST_CHECK(digits1[DigitsVector::InlineCount] == 5);
+
+	DigitsVector digits3 = digits1;
+	digits3.clear();
+	BOOST_CHECK(!digits1.IsShared());
+	BOOST_CHECK(digits1.size() == DigitsVector::InlineCount * 2);
+}
+
+BOOST_AUTO_TEST_CASE(CompoundOperators)
+{
+	IntX int1 = IntX::Pow(3, 1000);
+	IntX int2 = int1;
+	IntX int3 = int1;
+	IntX int4 = int1;
+	IntX int5 = int1;
+
+	int2 += 1;
+	int3 *= 3;
+	int4 <<= 7;
+	int5 |= 0xFFFFFFFFU;
+	BOOST_CHECK(int1 == IntX::Pow(3, 1000));
+	BOOST_CHECK(int2 - 1 == int1);
+	BOOST_CHECK(int3 == IntX::Pow(3, 1001));
+	BOOST_CHECK(int4 >> 7 == int1);
+	BOOST_CHECK(int5 != int1);
+}
+
+BOOST_AUTO_TEST_CASE(NormalizeAndInternalState)
+{
+	IntX int1 = (IntX(1) << (DigitsVector::InlineCount * 32 * 4)) + 7;
+	IntX int2 = int1 - (IntX(1) << (DigitsVector::InlineCount * 32 * 4));
+	IntX int3 = int2;
+	int3.Normalize();
+	BOOST_CHECK(int3 == 7);
+	BOOST_CHECK(int2 == 7);
+
+	vector<UInt32> digits;
+	bool negative;
+	IntX int4 = int1;
+	int4.GetInternalState(digits, negative);
+	BOOST_CHECK(IntX(digits, negative) == int1);
+}
+
+BOOST_AUTO_TEST_CASE(Containers)
+{
+	vector<IntX> values;
+	map<UInt32, IntX> valueMap;
+	IntX int1 = IntX::Pow(7, 500);
+	for (UInt32 i = 0; i < 10; ++i)
+	{
+		values.push_back(int1);
+		valueMap[i] = int1;
+	} // end for
+
+	values[3] -= 1;
+	valueMap[5] += 1;
+	BOOST_CHECK(values[3] + 1 == int1);
+	BOOST_CHECK(valueMap[5] - 1 == int1);
+	BOOST_CHECK(values[2] == int1 && valueMap[2] == int1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
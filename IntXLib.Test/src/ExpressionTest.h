@@ -0,0 +1,118 @@
+#define BOOST_TEST_MODULE ExpressionTest
+
+#include "../IntX.h"
+#include "../IntXExpression.h"
+#include "../Utils/Utils.h"
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ExpressionTest)
+
+vector<IntX> GetValues()
+{
+	return { IntX(), IntX(1), IntX(-1), IntX("0xFFFFFFFF"), IntX("-18446744073709551615"),
+		IntX("1234567890123456789012345678901234567890"), IntX("-1234567890123456789012345678901234567890") };
+} // end function GetValues
+
+BOOST_AUTO_TEST_CASE(MultiplyAdd)
+{
+	vector<IntX> values = GetValues();
+	for (const IntX &int1 : values)
+	{
+		for (const IntX &int2 : values)
+		{
+			for (const IntX &int3 : values)
+			{
+				IntX result = Lazy(int1) * int2 + int3;
+				BOOST_CHECK(result == int1 * int2 + int3);
+				result = int3 + Lazy(int1) * int2;
+				BOOST_CHECK(result == int1 * int2 + int3);
+				result = Lazy(int1) * int2 - int3;
+				BOOST_CHECK(result == int1 * int2 - int3);
+				result = int3 - int1 * Lazy(int2);
+				BOOST_CHECK(result == int3 - int1 * int2);
+			} // end for
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(MultiplyModulo)
+{
+	vector<IntX> values = GetValues();
+	for (const IntX &int1 : values)
+	{
+		for (const IntX &int2 : values)
+		{
+			for (const IntX &int3 : values)
+			{
+				if (int3 == 0) continue;
+
+				IntX result = (Lazy(int1) * int2) % int3;
+				BOOST_CHECK(result == (int1 * int2) % int3);
+			} // end for
+		} // end for
+	} // end for
+
+	IntX int1 = 1, zero = 0;
+	BOOST_CHECK_THROW(int1 = (Lazy(int1) * int1) % zero, DivideByZeroException);
+}
+
+BOOST_AUTO_TEST_CASE(ShiftAdd)
+{
+	vector<IntX> values = GetValues();
+	for (const IntX &int1 : values)
+	{
+		for (const IntX &int3 : values)
+		{
+			for (int shift = -70; shift <= 70; shift += 7)
+			{
+				IntX result = (Lazy(int1) << shift) + int3;
+				BOOST_CHECK(result == (int1 << shift) + int3);
+				result = int3 - (Lazy(int1) >> shift);
+				BOOST_CHECK(result == int3 - (int1 >> shift));
+			} // end for
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(SameObject)
+{
+	IntX int1 = IntX("-1234567890123456789012345678901234567890");
+	IntX int2 = int1;
+	int2 = Lazy(int2) * int2 + int2;
+	BOOST_CHECK(int2 == int1 * int1 + int1);
+
+	int2 = int1;
+	int2 = (Lazy(int2) * int2) % int2;
+	BOOST_CHECK(int2 == 0);
+
+	int2 = int1;
+	int2 = (Lazy(int2) << 40) - int2;
+	BOOST_CHECK(int2 == (int1 << 40) - int1);
+}
+
+BOOST_AUTO_TEST_CASE(BigMultiplyModulo)
+{
+	// Big enough to get to FHT multiplication and Newton division
+	IntX int1 = (IntX(1) << 320000) - 12345;
+	IntX int2 = (IntX(3) << 300000) + 54321;
+	IntX modulus = (IntX(1) << 290000) + 1;
+
+	IntX result = (Lazy(int1) * int2) % modulus;
+	BOOST_CHECK(result == (int1 * int2) % modulus);
+}
+
+BOOST_AUTO_TEST_CASE(ModPowLoop)
+{
+	IntX modulus = IntX("340282366920938463463374607431768211297");
+	IntX result = 1, result2 = 1, value = IntX("123456789123456789123456789");
+	for (int i = 0; i < 1000; i++)
+	{
+		result = (Lazy(result) * value) % modulus;
+		result2 = (result2 * value) % modulus;
+	} // end for
+	BOOST_CHECK(result == result2);
+	BOOST_CHECK(result == IntX::ModPow(value, 1000, modulus));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
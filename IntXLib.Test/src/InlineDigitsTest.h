@@ -0,0 +1,74 @@
+#define BOOST_TEST_MODULE InlineDigitsTest
+
+#include "../IntX.h"
+#include <vector>
+#include <utility>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(InlineDigitsTest)
+
+BOOST_AUTO_TEST_CASE(GrowAndShrink)
+{
+	IntX int1 = 1;
+	IntX int2 = int1 << (DigitsVector::InlineCount * 32 * 3);
+	IntX int3 = int2 >> (DigitsVector::InlineCount * 32 * 3);
+	BOOST_CHECK(int1 == int3);
+
+	IntX int4 = int2 - 1;
+	BOOST_CHECK(int4 + 1 == int2);
+	BOOST_CHECK(int2 - int4 == 1);
+}
+
+BOOST_AUTO_TEST_CASE(CopyAcrossBoundary)
+{
+	for (UInt32 i = 1; i < DigitsVector::InlineCount * 3; i++)
+	{
+		IntX int1 = (IntX(1) << (i * 32)) - 1;
+		IntX int2 = int1;
+		IntX int3 = IntX(int1);
+		BOOST_CHECK(int2 == int1);
+		BOOST_CHECK(int3 == int1);
+
+		IntX int4 = std::move(int3);
+		BOOST_CHECK(int4 == int1);
+		BOOST_CHECK(int3 == 0);
+
+		int3 = int4;
+		int4 = 5;
+		BOOST_CHECK(int3 == int1);
+		BOOST_CHECK(int4 == 5);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(InternalState)
+{
+	vector<UInt32> digits, digits2;
+	bool negative;
+	for (UInt32 i = 0; i < DigitsVector::InlineCount * 2; i++)
+	{
+		digits.push_back(i + 1);
+		IntX int1 = IntX(digits, true);
+		int1.GetInternalState(digits2, negative);
+		BOOST_CHECK(digits == digits2);
+		BOOST_CHECK(negative);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(NormalizeAfterShrink)
+{
+	IntX int1 = (IntX(1) << (DigitsVector::InlineCount * 32 * 2)) + 7;
+	IntX int2 = int1 - (IntX(1) << (DigitsVector::InlineCount * 32 * 2));
+	int2.Normalize();
+	BOOST_CHECK(int2 == 7);
+	BOOST_CHECK(int2.ToString() == "7");
+}
+
+BOOST_AUTO_TEST_CASE(DoubleValues)
+{
+	IntX int1 = IntX(1e300);
+	BOOST_CHECK((double)int1 == 1e300);
+	IntX int2 = IntX(-123456789.0);
+	BOOST_CHECK(int2 == -123456789);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,61 @@
+#define BOOST_TEST_MODULE KaratsubaTest
+
+#include "../IntX.h"
+#include "../Utils/Constants.h"
+#include "TestHelper.h"
+#include <boost/test/included/unit_test.hpp>
+
+// Returns true if Karatsuba products of given big integers (in both orders) are equal to classic one.
+static bool IsSameAsClassic(const IntX &int1, const IntX &int2)
+{
+	IntX expected = IntX::Multiply(int1, int2, MultiplyMode::mmClassic);
+	return IntX::Multiply(int1, int2, MultiplyMode::mmKaratsuba) == expected &&
+		IntX::Multiply(int2, int1, MultiplyMode::mmKaratsuba) == expected;
+}
+
+BOOST_AUTO_TEST_SUITE(KaratsubaTest)
+
+BOOST_AUTO_TEST_CASE(SplitPoints)
+{
+	// Lengths around the bound (shorter parts are multiplied classic way); odd lengths get higher part
+	// one digit shorter, and 2^k + 1 ones leave a single digit for it on the next level
+	UInt32 lengths[] = { Constants::KaratsubaLengthLowerBound - 1, Constants::KaratsubaLengthLowerBound,
+		Constants::KaratsubaLengthLowerBound + 1, 95, 97, 129, 255, 256, 513, 1000 };
+	for (UInt32 length : lengths)
+	{
+		BOOST_CHECK_MESSAGE(IsSameAsClassic(GetRandomValue(length, length), GetRandomValue(length, length * 7)), "length " << length);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(ShorterOperandAroundSplit)
+{
+	// Shorter big integer not longer than lower part is multiplied by pieces of longer one;
+	// one digit longer gets higher part of one digit only
+	UInt32 length1 = 999, splitLength = (length1 + 1) / 2;
+	UInt32 lengths2[] = { Constants::KaratsubaLengthLowerBound, splitLength - 1, splitLength, splitLength + 1, length1 - 1 };
+	IntX int1 = GetRandomValue(length1, 1);
+	for (UInt32 length2 : lengths2)
+	{
+		BOOST_CHECK_MESSAGE(IsSameAsClassic(int1, GetRandomValue(length2, length2)), "length " << length2);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(MiddleProductCarries)
+{
+	// Sums of parts of all-one digits overflow into the extra digit, so middle product is the biggest one
+	BOOST_CHECK(IsSameAsClassic(GetMaxValue(300), GetMaxValue(257)));
+	BOOST_CHECK(IntX::Multiply(GetMaxValue(300), GetMaxValue(300), MultiplyMode::mmKaratsuba) ==
+		(IntX(1) << (32 * 600)) - (IntX(1) << (32 * 300 + 1)) + 1);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroParts)
+{
+	// Zero lower or higher parts give zero outer products: middle product minus them must stay exact
+	IntX int1 = GetRandomValue(250, 2) << (32 * 250);
+	IntX int2 = GetRandomValue(250, 3);
+	BOOST_CHECK(IsSameAsClassic(int1, int2));
+	BOOST_CHECK(IsSameAsClassic(int1, int1 + 1));
+	BOOST_CHECK(IsSameAsClassic((IntX(1) << (32 * 499)) + 1, GetMaxValue(500)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
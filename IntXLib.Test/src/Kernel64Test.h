@@ -0,0 +1,80 @@
+#define BOOST_TEST_MODULE Kernel64Test
+
+#include "../IntX.h"
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(Kernel64Test)
+
+// Lengths up to this one cover all odd/even combinations processed by 64-bit kernels
+const UInt32 MaxLength = 17;
+
+vector<UInt32> GetDigits(const UInt32 length, const UInt32 value)
+{
+	vector<UInt32> digits(length);
+	for (UInt32 i = 0; i < digits.size(); ++i)
+	{
+		digits[i] = value - i;
+	} // end for
+	return digits;
+} // end function GetDigits
+
+BOOST_AUTO_TEST_CASE(AddSubCarry)
+{
+	for (UInt32 length1 = 1; length1 <= MaxLength; ++length1)
+	{
+		for (UInt32 length2 = 1; length2 <= MaxLength; ++length2)
+		{
+			IntX int1 = IntX(GetDigits(length1, 0xFFFFFFFF), false);
+			IntX int2 = IntX(GetDigits(length2, 0xFFFFFFF0), false);
+			IntX sum = int1 + int2;
+
+			BOOST_CHECK(sum - int2 == int1);
+			BOOST_CHECK(sum - int1 == int2);
+			BOOST_CHECK(int1 - int2 + int2 == int1);
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(MultiplyByDigit)
+{
+	for (UInt32 length = 1; length <= MaxLength; ++length)
+	{
+		IntX int1 = IntX(GetDigits(length, 0xFFFFFFFF), false);
+		IntX int2 = 0xFFFFFFFEU;
+		IntX product = int1 * int2;
+
+		BOOST_CHECK(product / int2 == int1);
+		BOOST_CHECK(product % int2 == 0);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(MultiplyClassic)
+{
+	for (UInt32 length1 = 1; length1 <= MaxLength; ++length1)
+	{
+		for (UInt32 length2 = 2; length2 <= MaxLength; ++length2)
+		{
+			IntX int1 = IntX(GetDigits(length1, 0xFFFFFFFF), false);
+			IntX int2 = IntX(GetDigits(length2, 0xFFFFFFFF), true);
+			IntX product = IntX::Multiply(int1, int2, MultiplyMode::mmClassic);
+			IntX remainder;
+
+			BOOST_CHECK(IntX::DivideModulo(product, int2, remainder, DivideMode::dmClassic) == int1);
+			BOOST_CHECK(remainder == 0);
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(MultiplyClassicWithZeroDigits)
+{
+	vector<UInt32> digits = GetDigits(MaxLength, 0xFFFFFFFF);
+	digits[2] = digits[3] = digits[8] = 0;
+	IntX int1 = IntX(digits, false);
+	IntX int2 = IntX(GetDigits(MaxLength - 4, 0xFFFFFFFF), false);
+
+	BOOST_CHECK(IntX::Multiply(int1, int2, MultiplyMode::mmClassic) / int2 == int1);
+	BOOST_CHECK(IntX::Multiply(int1, int1, MultiplyMode::mmClassic) / int1 == int1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
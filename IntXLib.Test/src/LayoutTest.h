@@ -0,0 +1,69 @@
+#define BOOST_TEST_MODULE LayoutTest
+
+#include "../IntX.h"
+#include <vector>
+#include <thread>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(LayoutTest)
+
+BOOST_AUTO_TEST_CASE(CompactSize)
+{
+	if (DigitsVector::InlineCount * sizeof(UInt32) == sizeof(UInt32 *))
+	{
+		BOOST_CHECK(sizeof(IntX) <= 16);
+	} // end if
+
+	IntX int1 = 0xFFFFFFFFFFFFFFFFULL;
+	IntX int2 = IntX() - int1;
+	BOOST_CHECK(int1.IsOdd());
+	BOOST_CHECK(int2 < 0);
+	BOOST_CHECK(int2 + int1 == 0);
+}
+
+BOOST_AUTO_TEST_CASE(VectorOfSmallValues)
+{
+	vector<IntX> values;
+	for (UInt32 i = 0; i < 1000; ++i)
+	{
+		values.push_back(IntX((long long)i * 0x7FFFFFFFLL - 500000000000LL));
+	} // end for
+
+	IntX sum;
+	for (UInt32 i = 0; i < values.size(); ++i)
+	{
+		sum += values[i];
+	} // end for
+	BOOST_CHECK(sum == IntX(499500LL * 0x7FFFFFFFLL - 500000000000000LL));
+}
+
+BOOST_AUTO_TEST_CASE(ThreadSettings)
+{
+	IntX int1 = 12345;
+	BOOST_CHECK(!IntX::getGlobalSettings()->getAutoNormalize());
+
+	IntX::getSettings()->setAutoNormalize(true);
+	IntX::getSettings()->setToStringMode(ToStringMode::tsmClassic);
+	BOOST_CHECK(IntX::getSettings()->getAutoNormalize());
+	BOOST_CHECK(int1.ToString() == "12345");
+
+	bool otherThreadNormalize = true;
+	ToStringMode otherThreadMode = ToStringMode::tsmClassic;
+	thread([&otherThreadNormalize, &otherThreadMode]()
+	{
+		otherThreadNormalize = IntX::getSettings()->getAutoNormalize();
+		otherThreadMode = IntX::getSettings()->getToStringMode();
+	}).join();
+	BOOST_CHECK(!otherThreadNormalize);
+	BOOST_CHECK(otherThreadMode == ToStringMode::tsmFast);
+
+	IntX::getSettings()->Reset();
+	BOOST_CHECK(!IntX::getSettings()->getAutoNormalize());
+
+	IntX::getGlobalSettings()->setToStringMode(ToStringMode::tsmClassic);
+	BOOST_CHECK(IntX::getSettings()->getToStringMode() == ToStringMode::tsmClassic);
+	IntX::getGlobalSettings()->setToStringMode(ToStringMode::tsmFast);
+	BOOST_CHECK(IntX::getSettings()->getToStringMode() == ToStringMode::tsmFast);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,122 @@
+#define BOOST_TEST_MODULE MemoryResourceTest
+
+#include "../IntX.h"
+#include <string>
+#include <boost/test/included/unit_test.hpp>
+
+// Resource which counts memory taken from it.
+class CountingResource : public MemoryResource
+{
+public:
+	CountingResource() : AllocationCount(0), UsedBytes(0) {}
+
+	UInt32 AllocationCount; // count of allocate calls
+	long long UsedBytes; // bytes which are not freed yet
+
+private:
+	virtual void *do_allocate(size_t bytes, size_t /* alignment */)
+	{
+		++AllocationCount;
+		UsedBytes += bytes;
+		return ::operator new(bytes);
+	}
+
+	virtual void do_deallocate(void *p, size_t bytes, size_t /* alignment */)
+	{
+		UsedBytes -= bytes;
+		::operator delete(p);
+	}
+
+	virtual bool do_is_equal(const MemoryResource &other) const noexcept
+	{
+		return this == &other;
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(MemoryResourceTest)
+
+BOOST_AUTO_TEST_CASE(AllocationsGoToResource)
+{
+	IntX expected = IntX::Pow(3, 200000);
+	string text = expected.ToString();
+
+	CountingResource resource;
+	{
+		IntXMemoryScope scope(&resource);
+		BOOST_CHECK(IntXMemory::GetResource() == &resource);
+
+		IntX value = IntX::Parse(text);
+		IntX square = value * value;
+		BOOST_CHECK(square / value == value);
+		BOOST_CHECK(square.ToString() == (expected * expected).ToString());
+		BOOST_CHECK(resource.AllocationCount > 0);
+	}
+
+	BOOST_CHECK(IntXMemory::GetResource() == nullptr);
+	BOOST_CHECK(resource.UsedBytes == 0);
+}
+
+BOOST_AUTO_TEST_CASE(CopyLeavesResource)
+{
+	CountingResource resource;
+	IntX copy;
+	{
+		IntX value;
+		{
+			IntXMemoryScope scope(&resource);
+			value = IntX::Pow(7, 1000);
+		}
+		BOOST_CHECK(resource.UsedBytes > 0);
+
+		copy = value;
+		BOOST_CHECK(copy == value);
+	}
+
+	BOOST_CHECK(resource.UsedBytes == 0);
+	BOOST_CHECK(copy == IntX::Pow(7, 1000));
+}
+
+BOOST_AUTO_TEST_CASE(ScratchDoesNotKeepResourceMemory)
+{
+	IntX int2 = IntX::Pow(5, 500);
+	IntX modulus = IntX::Pow(2, 700) + 1;
+
+	CountingResource resource;
+	{
+		IntX int1, int3;
+		{
+			IntXMemoryScope scope(&resource);
+			int1 = IntX::Pow(3, 500);
+			int3 = IntX::Pow(3, 600);
+			int1 *= int2;
+			IntX::MultiplyModulo(int3, int3, int2, modulus);
+		}
+
+		// Digits from resource are exchanged with per-thread buffers here
+		int1 *= int2;
+		IntX::MultiplyModulo(int3, int3, int2, modulus);
+		BOOST_CHECK(int1 == IntX::Pow(3, 500) * int2 * int2);
+		BOOST_CHECK(int3 == IntX::Pow(3, 600) * int2 % modulus * int2 % modulus);
+	}
+
+	BOOST_CHECK(resource.UsedBytes == 0);
+}
+
+#ifdef INTX_PMR
+BOOST_AUTO_TEST_CASE(MonotonicArena)
+{
+	IntX expected = IntX::Pow(12345, 3000) * IntX::Pow(54321, 3000);
+
+	std::pmr::monotonic_buffer_resource arena;
+	string text;
+	{
+		IntXMemoryScope scope(&arena);
+		IntX value = IntX::Pow(12345, 3000) * IntX::Pow(54321, 3000);
+		text = value.ToString();
+	}
+
+	BOOST_CHECK(text == expected.ToString());
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
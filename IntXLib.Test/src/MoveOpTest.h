@@ -0,0 +1,113 @@
+#define BOOST_TEST_MODULE MoveOpTest
+
+#include "../IntX.h"
+#include <vector>
+#include <utility>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(MoveOpTest)
+
+BOOST_AUTO_TEST_CASE(MoveConstructor)
+{
+	IntX int1 = IntX("-123456789012345678901234567890");
+	IntX int2 = std::move(int1);
+	BOOST_CHECK(int2 == IntX("-123456789012345678901234567890"));
+	BOOST_CHECK(int1 == 0);
+	BOOST_CHECK(!int1.IsNegative());
+}
+
+BOOST_AUTO_TEST_CASE(MoveAssignment)
+{
+	IntX int1 = IntX("98765432109876543210");
+	IntX int2 = 5;
+	int2 = std::move(int1);
+	BOOST_CHECK(int2 == IntX("98765432109876543210"));
+	BOOST_CHECK(int1 == 0);
+
+	int2 = std::move(int2);
+	BOOST_CHECK(int2 == IntX("98765432109876543210"));
+}
+
+BOOST_AUTO_TEST_CASE(SelfAssignment)
+{
+	IntX int1 = IntX("-98765432109876543210");
+	IntX &int2 = int1;
+	int1 = int2;
+	BOOST_CHECK(int1 == IntX("-98765432109876543210"));
+}
+
+BOOST_AUTO_TEST_CASE(RvalueAddSub)
+{
+	IntX values[] = { IntX(), IntX(1), IntX(-1), IntX("0xFFFFFFFF"), IntX("-18446744073709551615"),
+		IntX("1234567890123456789012345678901234567890"), IntX("-1234567890123456789012345678901234567890") };
+
+	for (const IntX &int1 : values)
+	{
+		for (const IntX &int2 : values)
+		{
+			BOOST_CHECK(IntX(int1) + int2 == int1 + int2);
+			BOOST_CHECK(IntX(int1) - int2 == int1 - int2);
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(RvalueSameObject)
+{
+	IntX int1 = IntX("0xFFFFFFFFFFFFFFFF");
+	BOOST_CHECK(std::move(int1) + int1 == IntX("0x1FFFFFFFFFFFFFFFE"));
+
+	IntX int2 = IntX("0xFFFFFFFFFFFFFFFF");
+	BOOST_CHECK(std::move(int2) - int2 == 0);
+
+	IntX int3 = IntX("-4294967295");
+	BOOST_CHECK(std::move(int3) * int3 == IntX("0xFFFFFFFE00000001"));
+}
+
+BOOST_AUTO_TEST_CASE(RvalueMultiply)
+{
+	IntX values[] = { IntX(), IntX(7), IntX(-3), IntX("0xFFFFFFFF"), IntX("-18446744073709551615"),
+		IntX("1234567890123456789012345678901234567890") };
+
+	for (const IntX &int1 : values)
+	{
+		for (const IntX &int2 : values)
+		{
+			BOOST_CHECK(IntX(int1) * int2 == int1 * int2);
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(RvalueShift)
+{
+	IntX int1 = IntX("-36170086419038336");
+
+	for (int i = 0; i < 200; i++)
+	{
+		BOOST_CHECK(IntX(int1) << i == int1 << i);
+		BOOST_CHECK(IntX(int1) >> i == int1 >> i);
+		BOOST_CHECK(IntX(int1) << -i == int1 >> i);
+	} // end for
+
+	for (int i = 1; i < 2000; i++)
+	{
+		IntX n = i;
+		n = std::move(n) << i;
+		n = std::move(n) >> i;
+		BOOST_CHECK(IntX(i) == n);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(RvalueScalar)
+{
+	IntX int1 = IntX("-1234567890123456789012345678901234567890");
+	BOOST_CHECK((int1 + int1) + 1 == int1 * 2 + 1);
+	BOOST_CHECK(IntX(7) * 3 == 21);
+	BOOST_CHECK((int1 - int1) - 2LL == -2);
+	BOOST_CHECK(IntX(int1) + 5U == int1 + 5U);
+	BOOST_CHECK(IntX(int1) - 5UL == int1 - 5UL);
+	BOOST_CHECK(IntX(int1) * 0xFFFFFFFFFFULL == int1 * 0xFFFFFFFFFFULL);
+	BOOST_CHECK(IntX(int1) + 1e10 == int1 + 1e10);
+	BOOST_CHECK(IntX(int1) * string("-3") == int1 * -3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,9 @@
 #define BOOST_TEST_MODULE MulOpFhtTest
 
 #include "../IntX.h"
+#include "../Utils/Constants.h"
+#include "../OpHelpers/FhtHelper.h"
+#include "../Multipliers/MultiplyManager.h"
 #include <vector>
 #include <cstdlib>
 #include <ctime>
@@ -43,6 +46,31 @@ vector<UInt32> GetRandomDigits()
 	return GetRandomDigits(rand() % (RandomEndLength - RandomStartLength) + RandomStartLength);
 } // end function GetRandomDigits
 
+// Returns count of FHT results rejected by validity check: they are computed again by NTT, so comparisons
+// with NTT can't catch FHT errors unless this count stays the same.
+UInt32 GetFallbackCount()
+{
+	return static_cast<AutoFhtMultiplier *>(MultiplyManager::GetMultiplier(MultiplyMode::mmAutoFht))->getFallbackCount();
+} // end function GetFallbackCount
+
+// FHT multiplier which checks a corrupted copy of each result, so every result must be rejected.
+class CorruptingFhtMultiplier : public AutoFhtMultiplier
+{
+public:
+	CorruptingFhtMultiplier()
+		: AutoFhtMultiplier(*MultiplyManager::GetMultiplier(MultiplyMode::mmToom4), *MultiplyManager::GetMultiplier(MultiplyMode::mmNtt)) {}
+
+protected:
+	virtual bool IsValid(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		const UInt32 *digitsResPtr, const double roundingError) const
+	{
+		// Single bit is flipped: rounding error stays the same, so only residues can show it
+		vector<UInt32> digitsRes(digitsResPtr, digitsResPtr + length1 + length2);
+		digitsRes[digitsRes.size() / 2] ^= 0x80U;
+		return AutoFhtMultiplier::IsValid(digitsPtr1, length1, digitsPtr2, length2, digitsRes.data(), roundingError);
+	} // end function IsValid
+};
+
 BOOST_AUTO_TEST_CASE(CompareWithClassic)
 {
 	srand(time(0));
@@ -68,6 +96,16 @@ BOOST_AUTO_TEST_CASE(SmallLargeCompareWithClassic)
 	BOOST_CHECK(classic == fht);
 }
 
+BOOST_AUTO_TEST_CASE(CompareWithClassicAboveBound)
+{
+	// Shorter big integers are multiplied by Toom-Cook algorithms in auto-FHT mode
+	IntX x = IntX(GetAllOneDigits(Constants::AutoFhtLengthLowerBound + 100), false);
+	IntX classic = IntX::Multiply(x, x, MultiplyMode::mmClassic);
+	IntX fht = IntX::Multiply(x, x, MultiplyMode::mmAutoFht);
+
+	BOOST_CHECK(classic == fht);
+}
+
 BOOST_AUTO_TEST_CASE(CompareWithClassicRandom)
 {
 	srand(time(0));
@@ -81,4 +119,216 @@ BOOST_AUTO_TEST_CASE(CompareWithClassicRandom)
 	} // end for
 }
 
+BOOST_AUTO_TEST_CASE(UnbalancedCompareWithNtt)
+{
+	UInt32 fallbackCount = GetFallbackCount();
+
+	// Longer big integers are multiplied by blocks (the last one is shorter)
+	UInt32 lengths[] = { Constants::AutoFhtUnbalancedLengthLowerBound, Constants::AutoFhtLengthLowerBound, 10000 };
+	UInt32 ratios[] = { 4, 17, 100 };
+	for (UInt32 length : lengths)
+	{
+		for (UInt32 ratio : ratios)
+		{
+			IntX x = IntX(GetRandomDigits(length * ratio + 123), false);
+			IntX y = IntX(GetRandomDigits(length), true);
+			IntX ntt = IntX::Multiply(x, y, MultiplyMode::mmNtt);
+
+			BOOST_CHECK(IntX::Multiply(x, y, MultiplyMode::mmAutoFht) == ntt);
+			BOOST_CHECK(IntX::Multiply(y, x, MultiplyMode::mmAutoFht) == ntt);
+		} // end for
+	} // end for
+
+	BOOST_CHECK(GetFallbackCount() == fallbackCount);
+}
+
+BOOST_AUTO_TEST_CASE(UnbalancedAllOneDigits)
+{
+	UInt32 fallbackCount = GetFallbackCount();
+
+	// Block products overlap, so carries between them are the biggest ones; middle blocks are zero
+	IntX x = (IntX(GetAllOneDigits(40000), false) << (32 * 200000)) + IntX(GetAllOneDigits(50000), false);
+	IntX y = IntX(GetAllOneDigits(Constants::AutoFhtLengthLowerBound), false);
+
+	BOOST_CHECK(IntX::Multiply(x, y, MultiplyMode::mmAutoFht) == IntX::Multiply(x, y, MultiplyMode::mmNtt));
+
+	BOOST_CHECK(GetFallbackCount() == fallbackCount);
+}
+
+BOOST_AUTO_TEST_CASE(CompareWithNttTransformLengths)
+{
+	UInt32 fallbackCount = GetFallbackCount();
+
+	// Transforms of 2^16..2^21 doubles (SIMD "butterflies" are used on most levels if CPU supports them,
+	// upper levels of the longer ones are done two at once)
+	UInt32 lengths[] = { Constants::AutoFhtLengthLowerBound, 12345, 40000, 100000, 262144 };
+	for (UInt32 length : lengths)
+	{
+		IntX x = IntX(GetRandomDigits(length), false);
+		IntX y = IntX(GetRandomDigits(length), true);
+
+		BOOST_CHECK(IntX::Multiply(x, y, MultiplyMode::mmAutoFht) == IntX::Multiply(x, y, MultiplyMode::mmNtt));
+		BOOST_CHECK(IntX::Multiply(x, x, MultiplyMode::mmAutoFht) == IntX::Multiply(x, x, MultiplyMode::mmNtt));
+	} // end for
+
+	BOOST_CHECK(GetFallbackCount() == fallbackCount);
+}
+
+BOOST_AUTO_TEST_CASE(PackingsCompareWithNtt)
+{
+	UInt32 fallbackCount = GetFallbackCount();
+
+	// Results of these lengths are packed by 16, 10, 13, 8 and 5 bits per double;
+	// maximal 16-bit halves give the biggest FHT values
+	UInt32 lengths[] = { 8192, 10000, 50000, 131072, 1000000 };
+	for (UInt32 length : lengths)
+	{
+		IntX x = IntX(vector<UInt32>(length, 0x7FFF7FFFU), false);
+		IntX y = IntX(GetRandomDigits(length), false);
+
+		BOOST_CHECK(IntX::Multiply(x, x, MultiplyMode::mmAutoFht) == IntX::Multiply(x, x, MultiplyMode::mmNtt));
+		BOOST_CHECK(IntX::Multiply(x, y, MultiplyMode::mmAutoFht) == IntX::Multiply(x, y, MultiplyMode::mmNtt));
+	} // end for
+
+	BOOST_CHECK(GetFallbackCount() == fallbackCount);
+}
+
+BOOST_AUTO_TEST_CASE(CyclicCompareWithNtt)
+{
+	UInt32 fallbackCount = GetFallbackCount();
+
+	// Results are a bit longer than half of usual transform can hold, so upper digits are wrapped to the lower ones;
+	// all-one digits give the biggest carries between both parts
+	UInt32 lengths[] = { 16500, 33000, 60000 };
+	for (UInt32 length : lengths)
+	{
+		IntX x = IntX(GetRandomDigits(length), false);
+		IntX y = IntX(GetRandomDigits(length * 3 / 4), true);
+		IntX z = (IntX(1) << (32 * length)) - 1;
+
+		BOOST_CHECK(IntX::Multiply(x, y, MultiplyMode::mmAutoFht) == IntX::Multiply(x, y, MultiplyMode::mmNtt));
+		BOOST_CHECK(IntX::Multiply(x, x, MultiplyMode::mmAutoFht) == IntX::Multiply(x, x, MultiplyMode::mmNtt));
+		BOOST_CHECK(IntX::Multiply(z, z, MultiplyMode::mmAutoFht) == (IntX(1) << (64 * length)) - (IntX(1) << (32 * length + 1)) + 1);
+		BOOST_CHECK(IntX::Multiply(z, z + 1, MultiplyMode::mmAutoFht) == (IntX(1) << (64 * length)) - (IntX(1) << (32 * length)));
+	} // end for
+
+	BOOST_CHECK(GetFallbackCount() == fallbackCount);
+}
+
+BOOST_AUTO_TEST_CASE(RoundingErrorOfResult)
+{
+	// Real digits are scaled by 0.5 / length: these ones are 1, 2, 1.4 and 3 (packed by 16 bits)
+	double exact[] = { 8.0, 16.0, 8.0, 24.0 }, imprecise[] = { 8.0, 16.0, 11.2, 24.0 };
+	UInt32 digits[2];
+
+	BOOST_CHECK(FhtHelper::ConvertDoubleToDigits(exact, 4, 2, digits, 16) == 0.0);
+	BOOST_CHECK(digits[0] == 0x00020001U && digits[1] == 0x00030001U);
+
+	double roundingError = FhtHelper::ConvertDoubleToDigits(imprecise, 4, 2, digits, 16);
+	BOOST_CHECK(roundingError > FhtHelper::MaxRoundingError && roundingError < 0.5);
+	BOOST_CHECK(digits[0] == 0x00020001U && digits[1] == 0x00030001U);
+}
+
+BOOST_AUTO_TEST_CASE(FusedFhtCompareWithSeparateSteps)
+{
+	// Digits take lower half of transform or more than it (then product is cyclic);
+	// transform is longer than blocks multiplied at once
+	UInt32 lengths[] = { 1000, 4000, 5000, 8000 };
+	for (UInt32 length : lengths)
+	{
+		vector<UInt32> digits1 = GetRandomDigits(length), digits2 = GetRandomDigits(length);
+		UInt32 dataLength = 4 * Constants::FhtMultiplyBlockLength;
+		int bits = 8;
+		UInt32 newLength = dataLength * bits / 32;
+
+		vector<double> data1(dataLength), data2(dataLength);
+		FhtHelper::ConvertDigitsToDouble(digits1.data(), length, data1.data(), dataLength, bits);
+		FhtHelper::Fht(data1.data(), dataLength);
+		FhtHelper::ConvertDigitsToDouble(digits2.data(), length, data2.data(), dataLength, bits);
+		FhtHelper::Fht(data2.data(), dataLength);
+		FhtHelper::MultiplyFhtResults(data1.data(), data2.data(), dataLength);
+		FhtHelper::ReverseFht(data1.data(), dataLength);
+		vector<UInt32> expected(newLength);
+		FhtHelper::ConvertDoubleToDigits(data1.data(), dataLength, newLength, expected.data(), bits);
+
+		vector<double> fused1(dataLength, 1.0), fused2(dataLength, 1.0);
+		FhtHelper::ConvertDigitsToFht(digits1.data(), length, fused1.data(), dataLength, bits, 1, nullptr);
+		FhtHelper::ConvertDigitsToFht(digits2.data(), length, fused2.data(), dataLength, bits, 1, fused1.data());
+		FhtHelper::ReverseFht(fused2.data(), dataLength);
+		vector<UInt32> digitsRes(newLength);
+		FhtHelper::ConvertDoubleToDigits(fused2.data(), dataLength, newLength, digitsRes.data(), bits);
+
+		BOOST_CHECK_MESSAGE(digitsRes == expected, "length " << length);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(ShortTransformsCompareWithClassic)
+{
+	// Transforms of 8..1024 doubles are done by codelets only, longer ones use them for the last recursion levels
+	for (UInt32 dataLength = 8; dataLength <= 4 * Constants::FhtCodeletLengthMax; dataLength <<= 1)
+	{
+		int bits = 8;
+		UInt32 length = dataLength / 8, newLength = dataLength / 4;
+		vector<UInt32> digits1 = GetRandomDigits(length), digits2 = GetRandomDigits(length);
+
+		vector<double> data1(dataLength), data2(dataLength);
+		FhtHelper::ConvertDigitsToDouble(digits1.data(), length, data1.data(), dataLength, bits);
+		FhtHelper::Fht(data1.data(), dataLength);
+		FhtHelper::ConvertDigitsToDouble(digits2.data(), length, data2.data(), dataLength, bits);
+		FhtHelper::Fht(data2.data(), dataLength);
+		FhtHelper::MultiplyFhtResults(data1.data(), data2.data(), dataLength);
+		FhtHelper::ReverseFht(data1.data(), dataLength);
+		vector<UInt32> digitsRes(newLength);
+		FhtHelper::ConvertDoubleToDigits(data1.data(), dataLength, newLength, digitsRes.data(), bits);
+
+		IntX classic = IntX::Multiply(IntX(digits1, false), IntX(digits2, false), MultiplyMode::mmClassic);
+		BOOST_CHECK_MESSAGE(IntX(digitsRes, false) == classic, "length " << dataLength);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(CorruptedResultFallsBackToNtt)
+{
+	CorruptingFhtMultiplier multiplier;
+	vector<UInt32> digits1 = GetRandomDigits(20000), digits2 = GetRandomDigits(15000);
+	IntX int1 = IntX(digits1, false), int2 = IntX(digits2, false);
+
+	// Rejected results are computed again by NTT
+	vector<UInt32> digitsRes(35000);
+	digitsRes.resize(multiplier.Multiply(digits1.data(), 20000, digits2.data(), 15000, digitsRes.data()));
+	BOOST_CHECK(IntX(digitsRes, false) == IntX::Multiply(int1, int2, MultiplyMode::mmNtt));
+	BOOST_CHECK(multiplier.getFallbackCount() == 1);
+
+	digitsRes.assign(40000, 0);
+	digitsRes.resize(multiplier.Sqr(digits1.data(), 20000, digitsRes.data()));
+	BOOST_CHECK(IntX(digitsRes, false) == IntX::Multiply(int1, int1, MultiplyMode::mmNtt));
+	BOOST_CHECK(multiplier.getFallbackCount() == 2);
+
+	// Residues aren't compared if check is turned off
+	IntX::getGlobalSettings()->setApplyFhtValidityCheck(false);
+	digitsRes.assign(35000, 0);
+	multiplier.Multiply(digits1.data(), 20000, digits2.data(), 15000, digitsRes.data());
+	BOOST_CHECK(multiplier.getFallbackCount() == 2);
+	IntX::getGlobalSettings()->setApplyFhtValidityCheck(true);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelFhtCompareWithNtt)
+{
+	UInt32 fallbackCount = GetFallbackCount();
+
+	// Transforms are split into parallel tasks (thread count isn't power of 2 here)
+	IntX::getGlobalSettings()->setFhtThreadCount(3);
+	UInt32 lengths[] = { 40000, 150000 };
+	for (UInt32 length : lengths)
+	{
+		IntX x = IntX(GetRandomDigits(length), false);
+		IntX y = IntX(GetRandomDigits(length + 777), true);
+
+		BOOST_CHECK(IntX::Multiply(x, y, MultiplyMode::mmAutoFht) == IntX::Multiply(x, y, MultiplyMode::mmNtt));
+		BOOST_CHECK(IntX::Multiply(x, x, MultiplyMode::mmAutoFht) == IntX::Multiply(x, x, MultiplyMode::mmNtt));
+	} // end for
+	IntX::getGlobalSettings()->setFhtThreadCount(1);
+
+	BOOST_CHECK(GetFallbackCount() == fallbackCount);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
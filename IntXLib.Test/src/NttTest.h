@@ -0,0 +1,52 @@
+#define BOOST_TEST_MODULE NttTest
+
+#include "../IntX.h"
+#include "../Utils/Constants.h"
+#include "../Multipliers/MultiplyManager.h"
+#include "TestHelper.h"
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(NttTest)
+
+BOOST_AUTO_TEST_CASE(TransformLengths)
+{
+	// Digits are packed into items by two (odd lengths leave the last item half-filled); products of 4096 + 4098
+	// and 8191 + 8193 digits fill their transforms exactly, a bit longer ones need twice longer transforms;
+	// shorter big integers are multiplied by lower multiplier
+	UInt32 lengths[][2] = { { 4096, 4098 }, { 4096, 4100 }, { 4097, 4097 }, { 8191, 8193 }, { 8192, 8196 },
+		{ Constants::NttLengthLowerBound - 1, 6000 } };
+	for (auto &pair : lengths)
+	{
+		IntX int1 = GetRandomValue(pair[0], pair[0]);
+		IntX int2 = GetRandomValue(pair[1], pair[1] * 3);
+		IntX expected = IntX::Multiply(int1, int2, MultiplyMode::mmClassic);
+		BOOST_CHECK_MESSAGE(IntX::Multiply(int1, int2, MultiplyMode::mmNtt) == expected, "lengths " << pair[0] << ", " << pair[1]);
+		BOOST_CHECK(IntX::Multiply(int2, int1, MultiplyMode::mmNtt) == expected);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(MaxDigitsAndSquare)
+{
+	// Convolution items are the biggest ones here, so all three residues are needed to restore them
+	IntX int1 = GetMaxValue(20000);
+	IntX int2 = GetMaxValue(9999);
+	BOOST_CHECK(IntX::Multiply(int1, int1, MultiplyMode::mmNtt) == (IntX(1) << (32 * 40000)) - (IntX(1) << (32 * 20000 + 1)) + 1);
+	BOOST_CHECK(IntX::Multiply(int1, int2, MultiplyMode::mmNtt) == IntX::Multiply(int1, int2, MultiplyMode::mmClassic));
+}
+
+BOOST_AUTO_TEST_CASE(CompareWithFht)
+{
+	// FHT results rejected by validity check would be computed by NTT, so none of them must be rejected here
+	AutoFhtMultiplier *fhtMultiplier = static_cast<AutoFhtMultiplier *>(MultiplyManager::GetMultiplier(MultiplyMode::mmAutoFht));
+	UInt32 fallbackCount = fhtMultiplier->getFallbackCount();
+	IntX::getGlobalSettings()->setApplyFhtValidityCheck(true);
+	IntX int1 = IntX() - GetRandomValue(100000, 1);
+	IntX int2 = GetRandomValue(70000, 2);
+	IntX expected = IntX::Multiply(int1, int2, MultiplyMode::mmAutoFht);
+	BOOST_CHECK(expected < 0);
+	BOOST_CHECK(IntX::Multiply(int1, int2, MultiplyMode::mmNtt) == expected);
+	BOOST_CHECK(IntX::Multiply(int1, int1, MultiplyMode::mmNtt) == IntX::Multiply(int1, int1, MultiplyMode::mmAutoFht));
+	BOOST_CHECK(fhtMultiplier->getFallbackCount() == fallbackCount);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
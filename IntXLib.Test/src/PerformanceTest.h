@@ -1,10 +1,43 @@
 #define BOOST_TEST_MODULE PerformanceTest
 
 #include "../IntX.h"
+#include "../OpHelpers/FhtHelper.h"
 #include <vector>
 #include <Windows.h>
 #include <boost/test/included/unit_test.hpp>
 
+// Resource which remembers the biggest amount of memory taken from it at once.
+class PeakMemoryResource : public MemoryResource
+{
+public:
+	PeakMemoryResource() : UsedBytes(0), PeakBytes(0) {}
+
+	long long UsedBytes; // bytes which are not freed yet
+	long long PeakBytes; // maximal UsedBytes value
+
+private:
+	virtual void *do_allocate(size_t bytes, size_t alignment)
+	{
+		UsedBytes += bytes;
+		if (UsedBytes > PeakBytes)
+		{
+			PeakBytes = UsedBytes;
+		}
+		return ::operator new(bytes);
+	}
+
+	virtual void do_deallocate(void *p, size_t bytes, size_t alignment)
+	{
+		UsedBytes -= bytes;
+		::operator delete(p);
+	}
+
+	virtual bool do_is_equal(const MemoryResource &other) const noexcept
+	{
+		return this == &other;
+	}
+};
+
 BOOST_AUTO_TEST_SUITE(PerformanceTest)
 
 BOOST_AUTO_TEST_CASE(Multiply128BitNumbers)
@@ -25,5 +58,265 @@ BOOST_AUTO_TEST_CASE(Multiply128BitNumbers)
 	BOOST_CHECK(true);
 }
 
+// Following cases measure 32-bit and 64-bit kernels (build with and without INTX_NO_64BIT_KERNELS to compare)
+
+BOOST_AUTO_TEST_CASE(Add4096BitNumbers)
+{
+	IntX int1 = IntX::Pow(3, 2583);
+	IntX int2 = IntX::Pow(7, 1459);
+
+	double startwatch = GetTickCount();
+
+	for (register UInt32 i = 0; i < 1000000; ++i)
+	{
+		int1 + int2;
+	} // end for
+
+	double endwatch = GetTickCount();
+
+	//return endwatch - startwatch;
+	BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE(Multiply4096BitNumbers)
+{
+	IntX int1 = IntX::Pow(3, 2583);
+	IntX int2 = IntX::Pow(7, 1459);
+
+	double startwatch = GetTickCount();
+
+	for (register UInt32 i = 0; i < 10000; ++i)
+	{
+		IntX::Multiply(int1, int2, MultiplyMode::mmClassic);
+	} // end for
+
+	double endwatch = GetTickCount();
+
+	//return endwatch - startwatch;
+	BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE(Divide8192By4096BitNumbers)
+{
+	IntX int1 = IntX::Pow(3, 5167);
+	IntX int2 = IntX::Pow(7, 1459);
+
+	double startwatch = GetTickCount();
+
+	for (register UInt32 i = 0; i < 100000; ++i)
+	{
+		IntX::Divide(int1, int2, DivideMode::dmClassic);
+	} // end for
+
+	double endwatch = GetTickCount();
+
+	//return endwatch - startwatch;
+	BOOST_CHECK(true);
+}
+
+// Shows crossover points of multiply algorithms (time of one multiplication for each length and mode)
+
+BOOST_AUTO_TEST_CASE(MultiplyCrossover)
+{
+	UInt32 lengths[] = { 16, 32, 48, 64, 128, 256, 512, 1024, 2048, 4096, 8192 };
+	MultiplyMode modes[] = { MultiplyMode::mmClassic, MultiplyMode::mmKaratsuba, MultiplyMode::mmToom3, MultiplyMode::mmToom4, MultiplyMode::mmNtt, MultiplyMode::mmAutoFht };
+
+	for (UInt32 length : lengths)
+	{
+		IntX int1 = (IntX(1) << (32 * length)) / 3;
+		IntX int2 = (IntX(1) << (32 * length)) / 7;
+		UInt32 count = 40000000 / length / length + 1;
+
+		for (MultiplyMode mode : modes)
+		{
+			double startwatch = GetTickCount();
+
+			for (register UInt32 i = 0; i < count; ++i)
+			{
+				IntX::Multiply(int1, int2, mode);
+			} // end for
+
+			double endwatch = GetTickCount();
+
+			BOOST_TEST_MESSAGE("length " << length << " mode " << mode << ": " << (endwatch - startwatch) / count << " ms");
+		} // end for
+	} // end for
+
+	BOOST_CHECK(true);
+}
+
+// Shows time of unbalanced multiplication (longer big integer is multiplied by blocks)
+// for each length of the shorter big integer and ratio of lengths
+
+BOOST_AUTO_TEST_CASE(MultiplyUnbalanced)
+{
+	UInt32 lengths[] = { 1024, 8192, 65536 };
+	UInt32 ratios[] = { 4, 16, 100, 1000 };
+
+	for (UInt32 length : lengths)
+	{
+		for (UInt32 ratio : ratios)
+		{
+			// Longer big integers would take too much memory
+			if ((UInt64)length * ratio > 16777216) continue;
+
+			IntX int1 = IntX(vector<UInt32>(length * ratio, 0x55555555U), false);
+			IntX int2 = IntX(vector<UInt32>(length, 0x24924924U), false);
+
+			double startwatch = GetTickCount();
+			IntX::Multiply(int1, int2, MultiplyMode::mmAutoFht);
+			double endwatch = GetTickCount();
+
+			BOOST_TEST_MESSAGE("length " << length << " ratio " << ratio << ": " << (endwatch - startwatch) << " ms");
+		} // end for
+	} // end for
+
+	BOOST_CHECK(true);
+}
+
+// Shows time of FHT, multiplication of FHT results and reverse FHT for each transform length
+// (build with and without INTX_NO_FHT_SIMD to compare SIMD and scalar kernels; transforms from
+// Constants::FhtBlockedLengthLowerBound doubles do two levels of "butterflies" in one pass over data;
+// slices up to Constants::FhtCodeletLengthMax doubles are done by codelets)
+
+BOOST_AUTO_TEST_CASE(FhtTransformLengths)
+{
+	for (int lengthLog2 = 12; lengthLog2 <= 26; ++lengthLog2)
+	{
+		UInt32 length = 1U << lengthLog2;
+		vector<double> data(length), data2(length, 0.0);
+		for (UInt32 i = 0; i < length; ++i)
+		{
+			data[i] = (double)(i % 255) - 127.0;
+		} // end for
+
+		// Scaled unit impulse, so data stays about the same after each multiplication
+		data2[0] = 0.5 / length;
+		FhtHelper::Fht(data2.data(), length);
+		UInt32 count = (1U << 24 >> lengthLog2) + 1;
+
+		double startwatch = GetTickCount();
+
+		for (register UInt32 i = 0; i < count; ++i)
+		{
+			FhtHelper::Fht(data.data(), length);
+			FhtHelper::MultiplyFhtResults(data.data(), data2.data(), length);
+			FhtHelper::ReverseFht(data.data(), length);
+		} // end for
+
+		double endwatch = GetTickCount();
+
+		BOOST_TEST_MESSAGE("length 2^" << lengthLog2 << ": " << (endwatch - startwatch) / count << " ms");
+	} // end for
+
+	BOOST_CHECK(true);
+}
+
+// Shows time of FHT multiplication for lengths around the ones where transform length is doubled
+// (results a bit longer than transform can hold are multiplied cyclically by twice shorter transform)
+
+BOOST_AUTO_TEST_CASE(MultiplyAcrossTransformLengths)
+{
+	UInt32 lengths[] = { 14000, 15360, 16500, 20000, 28000, 30000, 33000, 40000, 57344, 60000, 72000, 106496, 110000, 130000 };
+
+	for (UInt32 length : lengths)
+	{
+		IntX int1 = IntX(vector<UInt32>(length, 0x55555555U), false);
+		IntX int2 = IntX(vector<UInt32>(length, 0x24924924U), false);
+		UInt32 count = 4000000 / length + 1;
+
+		double startwatch = GetTickCount();
+
+		for (register UInt32 i = 0; i < count; ++i)
+		{
+			IntX::Multiply(int1, int2, MultiplyMode::mmAutoFht);
+		} // end for
+
+		double endwatch = GetTickCount();
+
+		BOOST_TEST_MESSAGE("length " << length << ": " << (endwatch - startwatch) / count << " ms");
+	} // end for
+
+	BOOST_CHECK(true);
+}
+
+// Shows time of FHT multiplication of million-digit big integers for each FHT thread count
+
+BOOST_AUTO_TEST_CASE(MultiplyParallelFht)
+{
+	UInt32 threadCounts[] = { 1, 2, 4, 8 };
+	IntX int1 = IntX(vector<UInt32>(1000000, 0x55555555U), false);
+	IntX int2 = IntX(vector<UInt32>(1000000, 0x24924924U), false);
+
+	for (UInt32 threadCount : threadCounts)
+	{
+		IntX::getGlobalSettings()->setFhtThreadCount(threadCount);
+
+		double startwatch = GetTickCount();
+		IntX::Multiply(int1, int2, MultiplyMode::mmAutoFht);
+		double endwatch = GetTickCount();
+
+		BOOST_TEST_MESSAGE("threads " << threadCount << ": " << (endwatch - startwatch) << " ms");
+	} // end for
+	IntX::getGlobalSettings()->setFhtThreadCount(1);
+
+	BOOST_CHECK(true);
+}
+
+// Compares time and peak memory (temporary buffers and result) of FHT and Schonhage-Strassen multiplications
+// of giant big integers. Needs a lot of memory: FHT takes about 140-450 bytes per operand digit (NTT is
+// used instead of it from 2^25 digits), Schonhage-Strassen takes about 42 bytes.
+
+BOOST_AUTO_TEST_CASE(MultiplyGiantNumbers)
+{
+	UInt32 lengths[] = { 10000000, 50000000, 100000000, 500000000 };
+	MultiplyMode modes[] = { MultiplyMode::mmAutoFht, MultiplyMode::mmSchonhageStrassen };
+
+	IntX::getGlobalSettings()->setApplyFhtValidityCheck(false);
+	for (UInt32 length : lengths)
+	{
+		// Digits are set directly since shift count would overflow for such lengths
+		IntX int1 = IntX(vector<UInt32>(length, 0x55555555U), false);
+		IntX int2 = IntX(vector<UInt32>(length, 0x24924924U), false);
+
+		for (MultiplyMode mode : modes)
+		{
+			PeakMemoryResource resource;
+			double startwatch, endwatch;
+			{
+				IntXMemoryScope scope(&resource);
+				startwatch = GetTickCount();
+				IntX result = IntX::Multiply(int1, int2, mode);
+				endwatch = GetTickCount();
+			}
+
+			BOOST_TEST_MESSAGE("length " << length << " mode " << mode << ": " << (endwatch - startwatch) << " ms, "
+				<< resource.PeakBytes / 1048576 << " MB");
+		} // end for
+	} // end for
+	IntX::getGlobalSettings()->setApplyFhtValidityCheck(true);
+
+	BOOST_CHECK(true);
+}
+
+BOOST_AUTO_TEST_CASE(ConstructSmallNumbers)
+{
+	// Memory footprint: sizeof(IntX) bytes per small number
+	vector<IntX> values;
+	values.reserve(10000000);
+
+	double startwatch = GetTickCount();
+
+	for (register UInt32 i = 0; i < 10000000; ++i)
+	{
+		values.push_back(IntX((long long)i * 0x7FFFFFFFLL));
+	} // end for
+
+	double endwatch = GetTickCount();
+
+	//return endwatch - startwatch;
+	BOOST_CHECK(values.capacity() * sizeof(IntX) <= 10000000 * 16);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
@@ -0,0 +1,102 @@
+#define BOOST_TEST_MODULE PreparedOperandTest
+
+#include "../IntX.h"
+#include "../Utils/Constants.h"
+#include "../Multipliers/MultiplyManager.h"
+#include "TestHelper.h"
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+
+// Multiplies prepared big integer by other one using given multiplier.
+static IntX MultiplyPrepared(IMultiplier *multiplier, const PreparedOperand &operand, const vector<UInt32> &digits2)
+{
+	vector<UInt32> digitsRes(operand.length + digits2.size());
+	UInt32 length = multiplier->Multiply(operand, digits2.data(), (UInt32)digits2.size(), digitsRes.data());
+	digitsRes.resize(length);
+	return IntX(digitsRes, false);
+}
+
+BOOST_AUTO_TEST_SUITE(PreparedOperandTest)
+
+BOOST_AUTO_TEST_CASE(AutoFhtCompareWithNtt)
+{
+	vector<UInt32> digits1 = GetRandomDigits(10000, 1);
+	IntX int1 = IntX(digits1, false);
+
+	IMultiplier *multiplier = MultiplyManager::GetMultiplier(MultiplyMode::mmAutoFht);
+	PreparedOperand operand(digits1.data(), (UInt32)digits1.size(), 12000);
+	multiplier->Prepare(operand);
+	BOOST_CHECK(operand.spectrum.size() != 0);
+
+	// Prepared FHT is used for the first lengths, other ones are multiplied usual way
+	UInt32 lengths[] = { 12000, 10000, 8192, 6000, 100, 1 };
+	for (UInt32 length : lengths)
+	{
+		vector<UInt32> digits2 = GetRandomDigits(length, length);
+		IntX expected = IntX::Multiply(int1, IntX(digits2, false), MultiplyMode::mmNtt);
+		BOOST_CHECK_MESSAGE(MultiplyPrepared(multiplier, operand, digits2) == expected, "length " << length);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(LongerOperandThanPrepared)
+{
+	// Transform length is the same, but result doesn't fit into packing of prepared digits
+	vector<UInt32> digits1 = GetRandomDigits(10000, 7);
+	IntX int1 = IntX(digits1, false);
+
+	IMultiplier *multiplier = MultiplyManager::GetMultiplier(MultiplyMode::mmAutoFht);
+	PreparedOperand operand(digits1.data(), (UInt32)digits1.size(), 12000);
+	multiplier->Prepare(operand);
+	BOOST_CHECK(operand.spectrum.size() != 0);
+
+	vector<UInt32> digits2 = GetRandomDigits(20000, 8);
+	IntX expected = IntX::Multiply(int1, IntX(digits2, false), MultiplyMode::mmNtt);
+	BOOST_CHECK(MultiplyPrepared(multiplier, operand, digits2) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(OtherModesAndShortOperands)
+{
+	vector<UInt32> digits1 = GetRandomDigits(3000, 2);
+	IntX int1 = IntX(digits1, false);
+	vector<UInt32> digits2 = GetRandomDigits(2500, 3);
+	IntX expected = IntX::Multiply(int1, IntX(digits2, false), MultiplyMode::mmClassic);
+
+	MultiplyMode modes[] = { MultiplyMode::mmClassic, MultiplyMode::mmKaratsuba, MultiplyMode::mmToom3,
+		MultiplyMode::mmToom4, MultiplyMode::mmNtt, MultiplyMode::mmSchonhageStrassen, MultiplyMode::mmAutoFht };
+	for (MultiplyMode mode : modes)
+	{
+		IMultiplier *multiplier = MultiplyManager::GetMultiplier(mode);
+		PreparedOperand operand(digits1.data(), (UInt32)digits1.size(), (UInt32)digits2.size());
+		multiplier->Prepare(operand);
+
+		// Nothing to prepare for such short big integers
+		BOOST_CHECK(operand.spectrum.size() == 0);
+		BOOST_CHECK_MESSAGE(MultiplyPrepared(multiplier, operand, digits2) == expected, "mode " << mode);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(ModPowWithPreparedValue)
+{
+	IntX value = IntX(GetRandomDigits(9000, 4), false);
+	IntX modulus = IntX(GetRandomDigits(9000, 5), false) + 1;
+
+	IntX expected = 1;
+	for (UInt32 i = 0; i < 19; ++i)
+	{
+		expected = expected * value % modulus;
+	} // end for
+
+	BOOST_CHECK(IntX::ModPow(value, 19, modulus) == expected);
+	BOOST_CHECK(IntX::ModPow(IntX() - value, 19, modulus) == IntX() - expected);
+	BOOST_CHECK(IntX::ModPow(value, 0, modulus) == 1);
+	BOOST_CHECK(IntX::ModPow(value, 1, 1) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(FastParseOfLongNumber)
+{
+	// Higher levels of fast parsing use prepared powers of base
+	IntX value = IntX(GetRandomDigits(30000, 6), false);
+	BOOST_CHECK(IntX::Parse(value.ToString(), ParseMode::pmFast) == value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
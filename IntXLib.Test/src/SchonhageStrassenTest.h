@@ -0,0 +1,46 @@
+#define BOOST_TEST_MODULE SchonhageStrassenTest
+
+#include "../IntX.h"
+#include "../Utils/Constants.h"
+#include "TestHelper.h"
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(SchonhageStrassenTest)
+
+BOOST_AUTO_TEST_CASE(RingLengths)
+{
+	// Product of 65536 + 65536 digits fills the ring exactly (it's multiple of parts count), one digit more
+	// makes it padded; higher parts of shorter big integer are zero in unbalanced case, and shorter big integers
+	// are multiplied by lower multiplier
+	UInt32 lengths[][2] = { { 65536, 65536 }, { 65537, 65536 }, { 100000, 131071 }, { 65536, 200000 },
+		{ Constants::SchonhageStrassenLengthLowerBound - 1, 100000 } };
+	for (auto &pair : lengths)
+	{
+		IntX int1 = GetRandomValue(pair[0], pair[0]);
+		IntX int2 = GetRandomValue(pair[1], pair[1] * 3);
+		IntX expected = IntX::Multiply(int1, int2, MultiplyMode::mmNtt);
+		BOOST_CHECK_MESSAGE(IntX::Multiply(int1, int2, MultiplyMode::mmSchonhageStrassen) == expected, "lengths " << pair[0] << ", " << pair[1]);
+		BOOST_CHECK(IntX::Multiply(int2, int1, MultiplyMode::mmSchonhageStrassen) == expected);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(MaxDigitsAndSquare)
+{
+	// Parts are the biggest ones here, so convolution items are the closest to the ring modulus
+	IntX int1 = GetMaxValue(100000);
+	IntX int2 = GetMaxValue(70000);
+	BOOST_CHECK(IntX::Multiply(int1, int1, MultiplyMode::mmSchonhageStrassen) == (IntX(1) << (32 * 200000)) - (IntX(1) << (32 * 100000 + 1)) + 1);
+	BOOST_CHECK(IntX::Multiply(int1, int2, MultiplyMode::mmSchonhageStrassen) == IntX::Multiply(int1, int2, MultiplyMode::mmNtt));
+}
+
+BOOST_AUTO_TEST_CASE(SparseParts)
+{
+	// First big integer has two one-bit parts (the others are zero), so its transformed parts are just sums of shifted bits
+	IntX int1 = (IntX(1) << (32 * 90000 + 7)) + 1;
+	IntX int2 = IntX() - GetRandomValue(80000, 7);
+	IntX result = IntX::Multiply(int1, int2, MultiplyMode::mmSchonhageStrassen);
+	BOOST_CHECK(result < 0);
+	BOOST_CHECK(result == (int2 << (32 * 90000 + 7)) + int2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
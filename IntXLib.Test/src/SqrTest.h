@@ -0,0 +1,128 @@
+#define BOOST_TEST_MODULE SqrTest
+
+#include "../IntX.h"
+#include "../IntXView.h"
+#include "../IntXExpression.h"
+#include "../Utils/Constants.h"
+#include "TestHelper.h"
+#include <boost/test/included/unit_test.hpp>
+
+// Checks that squaring (the same object) gives the same result as multiplying two different copies.
+static void CheckSqr(const UInt32 length, UInt32 seed, MultiplyMode mode, MultiplyMode referenceMode)
+{
+	IntX value = GetRandomValue(length, seed);
+	IntX copy = GetRandomValue(length, seed);
+	BOOST_CHECK_MESSAGE(IntX::Multiply(value, value, mode) == IntX::Multiply(value, copy, referenceMode), "length " << length);
+}
+
+BOOST_AUTO_TEST_SUITE(SqrTest)
+
+BOOST_AUTO_TEST_CASE(ClassicAndKaratsuba)
+{
+	UInt32 lengths[] = { 1, 2, 3, 4, 5, 17, 47, 48, 49, 95, 96, 97, 127, 200, 255, 256, 511, 1000 };
+	for (UInt32 length : lengths)
+	{
+		CheckSqr(length, length, MultiplyMode::mmClassic, MultiplyMode::mmClassic);
+		CheckSqr(length, length * 3, MultiplyMode::mmKaratsuba, MultiplyMode::mmClassic);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(ToomCook)
+{
+	UInt32 lengths[] = { 799, 800, 801, 1999, 2000, 2001, 4567, 6000 };
+	for (UInt32 length : lengths)
+	{
+		CheckSqr(length, length, MultiplyMode::mmToom3, MultiplyMode::mmKaratsuba);
+		CheckSqr(length, length * 5, MultiplyMode::mmToom4, MultiplyMode::mmKaratsuba);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(Transforms)
+{
+	UInt32 lengths[] = { 4095, 4096, 8191, 8192, 8193, 20000 };
+	for (UInt32 length : lengths)
+	{
+		CheckSqr(length, length, MultiplyMode::mmAutoFht, MultiplyMode::mmToom4);
+		CheckSqr(length, length * 7, MultiplyMode::mmNtt, MultiplyMode::mmToom4);
+	} // end for
+
+	CheckSqr(Constants::SchonhageStrassenLengthLowerBound + 3, 11, MultiplyMode::mmSchonhageStrassen, MultiplyMode::mmNtt);
+}
+
+BOOST_AUTO_TEST_CASE(MaxDigits)
+{
+	// All digits are 0xFFFFFFFF, so all carries (and doubled products) are the biggest ones
+	UInt32 lengths[] = { 1, 2, 3, 63, 96, 97, 801, 2001, 8193 };
+	MultiplyMode modes[] = { MultiplyMode::mmClassic, MultiplyMode::mmKaratsuba, MultiplyMode::mmToom3,
+		MultiplyMode::mmToom4, MultiplyMode::mmNtt, MultiplyMode::mmAutoFht };
+	for (UInt32 length : lengths)
+	{
+		IntX value = (IntX(1) << (32 * length)) - 1;
+		IntX expected = (IntX(1) << (64 * length)) - (IntX(1) << (32 * length + 1)) + 1;
+		for (MultiplyMode mode : modes)
+		{
+			BOOST_CHECK_MESSAGE(IntX::Multiply(value, value, mode) == expected, "length " << length << ", mode " << mode);
+		} // end for
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(SignAndZero)
+{
+	IntX value = IntX() - GetRandomValue(300, 9);
+	IntX result = IntX::Square(value);
+	BOOST_CHECK(result > 0);
+	BOOST_CHECK(result == IntX::Multiply(value, GetRandomValue(300, 9), MultiplyMode::mmClassic) * -1);
+	BOOST_CHECK(IntX::Square(IntX()) == 0);
+	BOOST_CHECK(IntX::Square(-7) == 49);
+}
+
+BOOST_AUTO_TEST_CASE(SharedDigitsOppositeSigns)
+{
+	// Copy and its negation share digits, but their product is not a square
+	IntX value = IntX::Pow(3, 200), copy = value;
+	IntX negated = -copy;
+	IntX expected = -IntX::Multiply(value, IntX::Pow(3, 200), MultiplyMode::mmClassic);
+	BOOST_CHECK(value * negated == expected);
+	BOOST_CHECK(negated * value == expected);
+	BOOST_CHECK(IntX::Multiply(value, negated, MultiplyMode::mmClassic) == expected);
+	BOOST_CHECK(IntX::Multiply(value, negated, MultiplyMode::mmKaratsuba) == expected);
+
+	IntX result = value;
+	result *= negated;
+	BOOST_CHECK(result == expected);
+	result = value;
+	BOOST_CHECK(std::move(result) * negated == expected);
+
+	IntX::MultiplyAdd(result, value, negated, 0);
+	BOOST_CHECK(result == expected);
+	result = Lazy(value) * negated;
+	BOOST_CHECK(result == expected);
+	IntXView view(value), negatedView(view.getDigits(), view.getLength(), true);
+	BOOST_CHECK(view.Value() * negatedView.Value() == expected);
+	BOOST_CHECK(negated * negated == -expected);
+}
+
+BOOST_AUTO_TEST_CASE(PowAndModPow)
+{
+	IntX value = GetRandomValue(50, 13);
+	IntX expected = 1;
+	for (int i = 0; i < 37; ++i)
+	{
+		expected = IntX::Multiply(expected, value, MultiplyMode::mmClassic);
+	} // end for
+	BOOST_CHECK(IntX::Pow(value, 37) == expected);
+	BOOST_CHECK(IntX::Pow(value, 37, MultiplyMode::mmKaratsuba) == expected);
+
+	IntX modulus = GetRandomValue(40, 17);
+	BOOST_CHECK(IntX::ModPow(value, 37, modulus) == expected % modulus);
+}
+
+BOOST_AUTO_TEST_CASE(IntegerSquareRoot)
+{
+	IntX value = GetRandomValue(100, 21);
+	IntX root = IntX::IntegerSquareRoot(value);
+	BOOST_CHECK(root * root <= value);
+	BOOST_CHECK((root + 1) * (root + 1) > value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,35 @@
+#pragma once
+
+#ifndef TESTHELPER_H
+#define TESTHELPER_H
+
+#include "../IntX.h"
+#include <vector>
+
+// Helpers shared by test modules.
+
+// Returns given count of pseudo-random digits (linear congruential generator, so digits are the same on each run).
+inline vector<UInt32> GetRandomDigits(const UInt32 length, UInt32 seed)
+{
+	vector<UInt32> digits(length);
+	for (UInt32 i = 0; i < length; ++i)
+	{
+		seed = seed * 1664525U + 1013904223U;
+		digits[i] = seed;
+	} // end for
+	return digits;
+} // end function GetRandomDigits
+
+// Returns big integer with given count of pseudo-random digits.
+inline IntX GetRandomValue(const UInt32 length, const UInt32 seed)
+{
+	return IntX(GetRandomDigits(length, seed), false);
+} // end function GetRandomValue
+
+// Returns big integer with given count of 0xFFFFFFFF digits (it gives the biggest carries).
+inline IntX GetMaxValue(const UInt32 length)
+{
+	return IntX(vector<UInt32>(length, 0xFFFFFFFFU), false);
+} // end function GetMaxValue
+
+#endif // !TESTHELPER_H
@@ -0,0 +1,88 @@
+#define BOOST_TEST_MODULE ToomCookTest
+
+#include "../IntX.h"
+#include "../Utils/Constants.h"
+#include "TestHelper.h"
+#include <vector>
+#include <boost/test/included/unit_test.hpp>
+
+// Returns true if products of given big integers (in both orders) in given Toom-Cook mode are equal to Karatsuba one.
+static bool IsSameAsKaratsuba(const IntX &int1, const IntX &int2, MultiplyMode mode)
+{
+	IntX expected = IntX::Multiply(int1, int2, MultiplyMode::mmKaratsuba);
+	return IntX::Multiply(int1, int2, mode) == expected && IntX::Multiply(int2, int1, mode) == expected;
+}
+
+// Returns big integer made of parts of given length; all digits of each part are equal to given one.
+static IntX GetPartsValue(const UInt32 partLength, const vector<UInt32> &partDigits)
+{
+	vector<UInt32> digits;
+	for (UInt32 digit : partDigits)
+	{
+		digits.insert(digits.end(), partLength, digit);
+	} // end for
+	return IntX(digits, false);
+}
+
+BOOST_AUTO_TEST_SUITE(ToomCookTest)
+
+BOOST_AUTO_TEST_CASE(LengthBounds)
+{
+	// Toom-3 and Toom-4 start from their bounds; parts of lengths not divisible by part count
+	// differ in length (the highest one is shorter)
+	UInt32 lengths[] = { Constants::Toom3LengthLowerBound - 1, Constants::Toom3LengthLowerBound, Constants::Toom3LengthLowerBound + 1,
+		1201, Constants::Toom4LengthLowerBound - 1, Constants::Toom4LengthLowerBound, Constants::Toom4LengthLowerBound + 1, 2603 };
+	for (UInt32 length : lengths)
+	{
+		IntX int1 = GetRandomValue(length, length), int2 = GetRandomValue(length, length * 5);
+		BOOST_CHECK_MESSAGE(IsSameAsKaratsuba(int1, int2, MultiplyMode::mmToom3), "length " << length);
+		BOOST_CHECK_MESSAGE(IsSameAsKaratsuba(int1, int2, MultiplyMode::mmToom4), "length " << length);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(UnbalancedPartCounts)
+{
+	// Shorter big integer is cut into fewer parts of the same length: each length here is the last or the first one
+	// for some count of parts (one part means that longer big integer is multiplied by pieces)
+	IntX int1 = GetRandomValue(6000, 1);
+	UInt32 partLength = 6000 / 3;
+	UInt32 lengths2[] = { partLength, partLength + 1, 2 * partLength, 2 * partLength + 1 };
+	for (UInt32 length2 : lengths2)
+	{
+		BOOST_CHECK_MESSAGE(IsSameAsKaratsuba(int1, GetRandomValue(length2, length2), MultiplyMode::mmToom3), "length " << length2);
+	} // end for
+
+	// Pieces must be long enough for Toom-4 too
+	IntX int3 = GetRandomValue(10000, 2);
+	partLength = 10000 / 4;
+	UInt32 lengths4[] = { partLength, partLength + 1, 2 * partLength, 2 * partLength + 1, 3 * partLength, 3 * partLength + 1 };
+	for (UInt32 length2 : lengths4)
+	{
+		BOOST_CHECK_MESSAGE(IsSameAsKaratsuba(int3, GetRandomValue(length2, length2), MultiplyMode::mmToom4), "length " << length2);
+	} // end for
+}
+
+BOOST_AUTO_TEST_CASE(NegativePointValues)
+{
+	// Zero and all-one parts give the biggest values in -1 and -2 of opposite signs,
+	// so interpolation subtracts big values and divides negative ones
+	IntX int1 = GetPartsValue(600, { 0, 0xFFFFFFFFU, 1 }), int2 = GetPartsValue(600, { 0xFFFFFFFFU, 0, 1 });
+	BOOST_CHECK(IsSameAsKaratsuba(int1, int2, MultiplyMode::mmToom3));
+	BOOST_CHECK(IsSameAsKaratsuba(int1, GetPartsValue(600, { 0, 0xFFFFFFFFU, 1 }), MultiplyMode::mmToom3));
+
+	IntX int3 = GetPartsValue(600, { 0, 0xFFFFFFFFU, 0, 0xFFFFFFFFU }), int4 = GetPartsValue(600, { 0xFFFFFFFFU, 0, 0xFFFFFFFFU, 1 });
+	BOOST_CHECK(IsSameAsKaratsuba(int3, int4, MultiplyMode::mmToom4));
+	BOOST_CHECK(IsSameAsKaratsuba(int3, int1, MultiplyMode::mmToom4));
+}
+
+BOOST_AUTO_TEST_CASE(ZeroPartsAndMaxDigits)
+{
+	// Zero inner parts (coefficients of product are got from outer ones only) and the biggest carries
+	IntX sparse = (IntX(1) << (32 * 5000)) + 1;
+	IntX max = GetMaxValue(4999), max2 = GetMaxValue(3300);
+	BOOST_CHECK(IsSameAsKaratsuba(sparse, max, MultiplyMode::mmToom4));
+	BOOST_CHECK(IsSameAsKaratsuba(max, max2, MultiplyMode::mmToom3));
+	BOOST_CHECK(IntX::Multiply(max, max, MultiplyMode::mmToom4) == (IntX(1) << (32 * 9998)) - (IntX(1) << (32 * 4999 + 1)) + 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+#define BOOST_TEST_MODULE ViewTest
+
+#include "../IntX.h"
+#include "../IntXView.h"
+#include <vector>
+#include <utility>
+#include <boost/test/included/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(ViewTest)
+
+BOOST_AUTO_TEST_CASE(ViewOverBuffer)
+{
+	vector<UInt32> buffer({ 7, 1, 2, 3, 0, 0 });
+	IntXView view(buffer.data() + 1, 5, true);
+	IntX value = IntX(vector<UInt32>({ 1, 2, 3 }), true);
+
+	BOOST_CHECK(view.getDigits() == buffer.data() + 1);
+	BOOST_CHECK(view.getLength() == 3);
+	BOOST_CHECK(view.IsNegative());
+	BOOST_CHECK(view == value);
+	BOOST_CHECK(value == view);
+	BOOST_CHECK(view.ToString() == value.ToString());
+	BOOST_CHECK(view.ToString(16) == value.ToString(16));
+}
+
+BOOST_AUTO_TEST_CASE(Operations)
+{
+	vector<UInt32> buffer1({ 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 5 });
+	vector<UInt32> buffer2({ 0x12345678, 0x9ABCDEF0 });
+	IntXView view1(buffer1.data(), (UInt32)buffer1.size(), false);
+	IntXView view2(buffer2.data(), (UInt32)buffer2.size(), true);
+	IntX int1 = IntX(buffer1, false);
+	IntX int2 = IntX(buffer2, true);
+
+	BOOST_CHECK(view1 + view2 == int1 + int2);
+	BOOST_CHECK(view1 - int2 == int1 - int2);
+	BOOST_CHECK(int1 - view2 == int1 - int2);
+	BOOST_CHECK(view1 * view2 == int1 * int2);
+	BOOST_CHECK(view1 / view2 == int1 / int2);
+	BOOST_CHECK(view1 % int2 == int1 % int2);
+	BOOST_CHECK(view1 > view2);
+	BOOST_CHECK(view2 <= int1);
+	BOOST_CHECK(IntX::Multiply(view1, view2, MultiplyMode::mmClassic) == int1 * int2);
+	BOOST_CHECK(IntX::Divide(view1, view2, DivideMode::dmClassic) == int1 / int2);
+
+	// Viewed digits are never changed
+	BOOST_CHECK(buffer1 == vector<UInt32>({ 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 5 }));
+	BOOST_CHECK(buffer2 == vector<UInt32>({ 0x12345678, 0x9ABCDEF0 }));
+}
+
+BOOST_AUTO_TEST_CASE(CopyIsOwning)
+{
+	vector<UInt32> buffer({ 1, 2, 3, 4, 5 });
+	IntXView view(buffer.data(), (UInt32)buffer.size(), false);
+	IntX copy = view;
+	copy += 1;
+	buffer[0] = 10;
+
+	BOOST_CHECK(copy == IntX(vector<UInt32>({ 2, 2, 3, 4, 5 }), false));
+	BOOST_CHECK(view == IntX(vector<UInt32>({ 10, 2, 3, 4, 5 }), false));
+}
+
+BOOST_AUTO_TEST_CASE(ViewOfIntX)
+{
+	IntX value = IntX::Pow(3, 500);
+	IntXView view(value);
+	IntXView view2 = view;
+
+	BOOST_CHECK(view2 == value);
+	BOOST_CHECK(view2.getLength() == view.getLength());
+	BOOST_CHECK(view.getDigits() == view2.getDigits());
+	BOOST_CHECK(view2 * 3 == IntX::Pow(3, 501));
+}
+
+BOOST_AUTO_TEST_CASE(AdoptBuffer)
+{
+	DigitsVector digits(40);
+	UInt32 *digitsPtr = digits.data();
+	digitsPtr[0] = 5;
+	digitsPtr[20] = 1;
+
+	IntX value = IntX(std::move(digits), true);
+	BOOST_CHECK(digits.size() == 0);
+	BOOST_CHECK(value == -((IntX(1) << (20 * 32)) + 5));
+	BOOST_CHECK(IntXView(value).getDigits() == digitsPtr);
+	BOOST_CHECK(IntXView(value).getLength() == 21);
+
+	IntX zero = IntX(DigitsVector(3), true);
+	BOOST_CHECK(zero == 0);
+	BOOST_CHECK(!zero.IsNegative());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,7 @@ typedef unsigned int UInt32;
 #include "DividerBase.h"
 #include "IDivider.h"
 #include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
 #include "../OpHelpers/NewtonHelper.h"
 #include "../Multipliers/IMultiplier.h"
 #include "../Multipliers/MultiplyManager.h"
@@ -54,67 +55,6 @@ private:
 
 public:
 	
-	/// <summary>
-	/// Divides two big integers.
-	/// Also modifies <paramref name="digits1" /> and <paramref name="length1"/> (it will contain remainder).
-	/// </summary>
-	/// <param name="digits1">First big integer digits.</param>
-	/// <param name="digitsBuffer1">Buffer for first big integer digits. May also contain remainder. Can be null - in this case it's created if necessary.</param>
-	/// <param name="length1">First big integer length.</param>
-	/// <param name="digits2">Second big integer digits.</param>
-	/// <param name="digitsBuffer2">Buffer for second big integer digits. Only temporarily used. Can be null - in this case it's created if necessary.</param>
-	/// <param name="length2">Second big integer length.</param>
-	/// <param name="digitsRes">Resulting big integer digits.</param>
-	/// <param name="resultFlags">Which operation results to return.</param>
-	/// <param name="cmpResult">Big integers comparsion result (pass -2 if omitted).</param>
-	/// <returns>Resulting big integer length.</returns>
-	virtual UInt32 DivMod(
-		vector<UInt32> &digits1,
-		vector<UInt32> &digitsBuffer1,
-		UInt32 &length1,
-		vector<UInt32> &digits2,
-		vector<UInt32> &digitsBuffer2,
-		UInt32 length2,
-		vector<UInt32> &digitsRes,
-		DivModResultFlags resultFlags,
-		int cmpResult)
-	{
-		// Maybe immediately use classic algorithm here
-		if (IsClassicAlgorithmNeeded(length1, length2))
-		{
-			return _classicDivider->DivMod(
-				digits1,
-				digitsBuffer1,
-				length1,
-				digits2,
-				digitsBuffer2,
-				length2,
-				digitsRes,
-				resultFlags,
-				cmpResult);
-		} // end if
-
-		// Create some buffers if necessary
-		if (digitsBuffer1.empty())
-		{
-			digitsBuffer1 = vector<UInt32>(length1 + 1);
-		} // end if
-
-		UInt32* digitsPtr1 = &digits1[0], *digitsBufferPtr1 = &digitsBuffer1[0], *digitsPtr2 = &digits2[0], *digitsBufferPtr2 = (!digitsBuffer2.empty() ? &digitsBuffer2[0] : &digits1[0]), *digitsResPtr = (!digitsRes.empty() ? &digitsRes[0] : &digits1[0]);
-		
-		return DivMod(
-			digitsPtr1,
-			digitsBufferPtr1,
-			length1,
-			digitsPtr2,
-			digitsBufferPtr2 == digitsPtr1 ? nullptr : digitsBufferPtr2,
-			length2,
-			digitsResPtr == digitsPtr1 ? nullptr : digitsResPtr,
-			resultFlags,
-			cmpResult);
-	} // end function DivMod
-
-	
 	/// <summary>
 	/// Divides two big integers.
 	/// Also modifies <paramref name="digitsPtr1" /> and <paramref name="length1"/> (it will contain remainder).
@@ -172,7 +112,7 @@ public:
 		// First retrieve opposite for the divider
 		UInt32 int2OppositeLength;
 		UInt64 int2OppositeRightShift;
-		vector<UInt32> int2OppositeDigits = NewtonHelper::GetIntegerOpposite(
+		PooledArray<UInt32> int2OppositeDigits = NewtonHelper::GetIntegerOpposite(
 			digitsPtr2,
 			length2,
 			length1,
@@ -183,12 +123,12 @@ public:
 		// We will need to muptiply it by divident now to receive quotient.
 		// Prepare digits for multiply result
 		UInt32 quotLength;
-		vector<UInt32> quotDigits(length1 + int2OppositeLength);
+		PooledArray<UInt32> quotDigits(length1 + int2OppositeLength);
 
 		IMultiplier *multiplier = MultiplyManager::GetCurrentMultiplier();
 
 		// Fix some arrays
-		UInt32* oppositePtr = &int2OppositeDigits[0], *quotPtr = &quotDigits[0];
+		UInt32* oppositePtr = int2OppositeDigits.data(), *quotPtr = quotDigits.data();
 		
 		// Multiply
 		quotLength = multiplier->Multiply(
@@ -230,9 +170,9 @@ public:
 		// Check quotient - finally it might be too big.
 		// For this we must multiply quotient by divider
 		UInt32 quotDivLength;
-		vector<UInt32> quotDivDigits(quotLength + length2);
+		PooledArray<UInt32> quotDivDigits(quotLength + length2);
 		
-		UInt32* quotDivPtr = &quotDivDigits[0];
+		UInt32* quotDivPtr = quotDivDigits.data();
 		
 		quotDivLength = multiplier->Multiply(quotPtr, quotLength, digitsPtr2, length2, quotDivPtr);
 
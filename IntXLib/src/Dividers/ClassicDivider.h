@@ -17,42 +17,6 @@ typedef unsigned int UInt32;
 class ClassicDivider : public DividerBase
 {
 public:
-	virtual UInt32 DivMod(
-		vector<UInt32> &digits1,
-		vector<UInt32> &digitsBuffer1,
-		UInt32 &length1,
-		vector<UInt32> &digits2,
-		vector<UInt32> &digitsBuffer2,
-		UInt32 length2,
-		vector<UInt32> &digitsRes,
-		DivModResultFlags resultFlags,
-		int cmpResult)
-	{
-		// Create some buffers if necessary
-		if (digitsBuffer1.empty())
-		{
-			digitsBuffer1 = vector<UInt32>(length1 + 1);
-		} // end if
-		if (digitsBuffer2.empty())
-		{
-			digitsBuffer2 = vector<UInt32>(length2);
-		} // end if
-
-		UInt32* digitsPtr1 = &digits1[0], *digitsBufferPtr1 = &digitsBuffer1[0], *digitsPtr2 = &digits2[0], *digitsBufferPtr2 = &digitsBuffer2[0], *digitsResPtr = (!digitsRes.empty()) ? &digitsRes[0] : &digits1[0];
-		
-		return DivMod(
-			digitsPtr1,
-			digitsBufferPtr1,
-			length1,
-			digitsPtr2,
-			digitsBufferPtr2,
-			length2,
-			digitsResPtr == digitsPtr1 ? nullptr : &digitsResPtr[0],
-			resultFlags,
-			cmpResult);
-		
-	} // end function DivMod
-
 	/// <summary>
 	/// Divides two big integers.
 	/// Also modifies <paramref name="digitsPtr1" /> and <paramref name="length1"/> (it will contain remainder).
@@ -10,6 +10,7 @@ typedef unsigned int UInt32;
 #include "IDivider.h"
 #include "../Utils/Utils.h"
 #include "../OpHelpers/DigitOpHelper.h"
+#include "../Utils/DigitsVector.h"
 
 #include <vector>
 
@@ -97,16 +98,21 @@ public:
 			modRes = IntX();
 		} //end else
 
+		// Remainder is built right in modRes, otherwise temporary buffer is needed.
+		// Second buffer is only temporarily used for shifted divider
+		DigitsVector digitsBuffer1(modNeeded ? 0U : int1.length + 1U);
+		DigitsVector digitsBuffer2(int2.length);
+
 		// Call procedure itself
 		UInt32 modLength = int1.length;
 		UInt32 divLength = DivMod(
-			(vector<UInt32>)int1.digits,
-			modRes.digits, //modNeeded ? modRes.digits : vector<UInt32>(),
+			(UInt32*)int1.digits.data(),
+			modNeeded ? modRes.digits.data() : digitsBuffer1.data(),
 			modLength,
-			(vector<UInt32>)int2.digits,
-			vector<UInt32>(),
+			(UInt32*)int2.digits.data(),
+			digitsBuffer2.data(),
 			int2.length,
-			divRes.digits, //divNeeded ? divRes.digits : vector<UInt32>(),
+			divNeeded ? divRes.digits.data() : nullptr,
 			resultFlags,
 			compareResult);
 
@@ -126,49 +132,6 @@ public:
 		return divRes;
 	} // end function DivMod
 
-	/// <summary>
-	/// Divides two big integers.
-	/// Also modifies <paramref name="digits1" /> and <paramref name="length1"/> (it will contain remainder).
-	/// </summary>
-	/// <param name="digits1">First big integer digits.</param>
-	/// <param name="digitsBuffer1">Buffer for first big integer digits. May also contain remainder. Can be null - in this case it's created if necessary.</param>
-	/// <param name="length1">First big integer length.</param>
-	/// <param name="digits2">Second big integer digits.</param>
-	/// <param name="digitsBuffer2">Buffer for second big integer digits. Only temporarily used. Can be null - in this case it's created if necessary.</param>
-	/// <param name="length2">Second big integer length.</param>
-	/// <param name="digitsRes">Resulting big integer digits.</param>
-	/// <param name="resultFlags">Which operation results to return.</param>
-	/// <param name="cmpResult">Big integers comparsion result (pass -2 if omitted).</param>
-	/// <returns>Resulting big integer length.</returns>
-	virtual UInt32 DivMod(
-		vector<UInt32> &digits1,
-		vector<UInt32> &digitsBuffer1,
-		UInt32 &length1,
-		vector<UInt32> &digits2,
-		vector<UInt32> &digitsBuffer2,
-		UInt32 length2,
-		vector<UInt32> &digitsRes,
-		DivModResultFlags resultFlags,
-		int cmpResult)
-	{
-		UInt32* digitsPtr1 = &digits1[0];
-		UInt32* digitsBufferPtr1 = &digitsBuffer1[0];
-		UInt32* digitsPtr2 = &digits2[0];
-		UInt32* digitsBufferPtr2 = &digitsBuffer2[0];
-		UInt32* digitsResPtr = &digitsRes[0];
-
-		return DivMod(
-				digitsPtr1,
-				digitsBufferPtr1,
-				length1,
-				digitsPtr2,
-				digitsBufferPtr2,
-				length2,
-				digitsResPtr,
-				resultFlags,
-				cmpResult);
-	} // end function DivMod
-
 	/// <summary>
 	/// Divides two big integers.
 	/// Also modifies <paramref name="digitsPtr1" /> and <paramref name="length1"/> (it will contain remainder).
@@ -49,17 +49,6 @@ public:
 		DivModResultFlags resultFlags,
 		int cmpResult) = 0;
 
-	virtual UInt32 DivMod(
-		vector<UInt32> &digits1,
-		vector<UInt32> &digitsBuffer1,
-		UInt32 &length1,
-		vector<UInt32> &digits2,
-		vector<UInt32> &digitsBuffer2,
-		UInt32 length2,
-		vector<UInt32> &digitsRes,
-		DivModResultFlags resultFlags,
-		int cmpResult) = 0;
-
 }; // end class IDivider
 
 #endif // !IDIVIDER_H
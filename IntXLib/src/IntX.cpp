@@ -24,7 +24,7 @@ IntXGlobalSettings IntX::globalSettings = IntXGlobalSettings();
 //  Constructors
 //==================================================================
 //
-IntX::IntX(const int value)
+IntX::IntX(const int value) : IntX()
 {
 	if (value == 0)
 	{
@@ -35,14 +35,16 @@ IntX::IntX(const int value)
 	{
 		// Prepare internal fields
 		length = 1;
-		digits = vector<UInt32>(length);
+		digits.resize(length);
 
 		// Fill the only big integer digit
-		DigitHelper::ToUInt32WithSign(value, digits[0], negative);
+		bool newNegative;
+		DigitHelper::ToUInt32WithSign(value, digits[0], newNegative);
+		negative = newNegative;
 	} // end else
 } // end constructor
 
-IntX::IntX(const UInt32 value)
+IntX::IntX(const UInt32 value) : IntX()
 {
 	if (value == 0)
 	{
@@ -53,12 +55,12 @@ IntX::IntX(const UInt32 value)
 	{
 		// Prepare internal fields
 		length = 1;
-		digits = vector<UInt32>(length);
+		digits.resize(length);
 		digits[0] = value;
 	} // end else
 } // end constructor
 
-IntX::IntX(const long long value)
+IntX::IntX(const long long value) : IntX()
 {
 	if (value == 0)
 	{
@@ -69,12 +71,14 @@ IntX::IntX(const long long value)
 	{
 		// Fill the only big integer digit
 		UInt64 newValue;
-		DigitHelper::ToUInt64WithSign(value, newValue, negative);
+		bool newNegative;
+		DigitHelper::ToUInt64WithSign(value, newValue, newNegative);
+		negative = newNegative;
 		InitFromUlong(newValue);
 	} // end else
 } // end constructor
 
-IntX::IntX(const unsigned long value)
+IntX::IntX(const unsigned long value) : IntX()
 {
 	if (value == 0)
 	{
@@ -87,7 +91,7 @@ IntX::IntX(const unsigned long value)
 	} // end else
 } // end constructor
 
-IntX::IntX(const UInt64 value)
+IntX::IntX(const UInt64 value) : IntX()
 {
 	if (value == 0)
 	{
@@ -100,7 +104,7 @@ IntX::IntX(const UInt64 value)
 	} // end else
 } // end constructor
 
-IntX::IntX(const float value)
+IntX::IntX(const float value) : IntX()
 {
 	// Exceptions
 	if (value == FP_INFINITE)
@@ -111,7 +115,7 @@ IntX::IntX(const float value)
 	OpHelper::SetDigitsFromDouble(value, digits, *this);
 } // end .cctor float
 
-IntX::IntX(const double value)
+IntX::IntX(const double value) : IntX()
 {
 	// Exceptions
 	if (value == FP_INFINITE)
@@ -122,43 +126,46 @@ IntX::IntX(const double value)
 	OpHelper::SetDigitsFromDouble(value, digits, *this);
 } // end .cctor double
 
-IntX::IntX(const char *value)
+IntX::IntX(const char *value) : IntX()
 {
-	IntX intX = Parse(value);
-	InitFromIntX(intX);
+	*this = Parse(value);
 } // end constructor 
 
-IntX::IntX(const char *value, const UInt32 numberBase)
+IntX::IntX(const char *value, const UInt32 numberBase) : IntX()
 {
-	IntX intX = Parse(value, numberBase);
-	InitFromIntX(intX);
+	*this = Parse(value, numberBase);
 } // end constructor
 
-IntX::IntX(const string &value)
+IntX::IntX(const string &value) : IntX()
 {
-	IntX intX = Parse(value);
-	InitFromIntX(intX);
+	*this = Parse(value);
 } // end constructor 
 
-IntX::IntX(const string &value, const UInt32 numberBase)
+IntX::IntX(const string &value, const UInt32 numberBase) : IntX()
 {
-	IntX intX = Parse(value, numberBase);
-	InitFromIntX(intX);
+	*this = Parse(value, numberBase);
 } // end constructor
 
-IntX::IntX(const IntX &value)
+IntX::IntX(const IntX &value) : IntX()
 {
 	InitFromIntX(value);
 } // end .cctor
 
-IntX::IntX(const UInt32 length, const bool negative)
+IntX::IntX(IntX &&value) noexcept
+	: digits(std::move(value.digits)), length(value.length), negative(value.negative)
+{
+	value.length = 0;
+	value.negative = false;
+} // end move constructor
+
+IntX::IntX(const UInt32 length, const bool negative) : IntX()
 {
 	this->length = length;
-	this->digits = vector<UInt32>(length);
+	this->digits.resize(length);
 	this->negative = negative;
 } // end constructor
 
-IntX::IntX(const UInt32 *digits, const bool negative, const UInt32 length)
+IntX::IntX(const UInt32 *digits, const bool negative, const UInt32 length) : IntX()
 {
 	// Exceptions
 	if (digits == nullptr)
@@ -169,11 +176,20 @@ IntX::IntX(const UInt32 *digits, const bool negative, const UInt32 length)
 	InitFromDigits(digits, negative, length);
 } // end constructor
 
-IntX::IntX(const vector<UInt32> &digits, const bool negative, const UInt32 length)
+IntX::IntX(const vector<UInt32> &digits, const bool negative, const UInt32 length) : IntX()
 {
 	InitFromDigits(digits, negative, length);
 } // end constructor
 
+IntX::IntX(DigitsVector &&digits, const bool negative) : IntX()
+{
+	this->digits = std::move(digits);
+
+	const DigitsVector &newDigits = this->digits;
+	this->length = DigitHelper::GetRealDigitsLength(newDigits.data(), newDigits.size());
+	this->negative = this->length != 0 && negative;
+} // end constructor
+
 
 //==================================================================
 //  Comparable implementation
@@ -347,7 +363,7 @@ string IntX::ToString(const UInt32 numberBase) const
 /// <returns>Object string representation.</returns>
 string IntX::ToString(const UInt32 numberBase, const bool upperCase) const
 {
-	return StringConvertManager::GetStringConverter(settings.getToStringMode())
+	return StringConvertManager::GetStringConverter(getSettings()->getToStringMode())
 		->ToString(*this, numberBase, upperCase ? Constants::BaseUpperChars : Constants::BaseLowerChars);
 } // end function ToString
 
@@ -360,7 +376,7 @@ string IntX::ToString(const UInt32 numberBase, const bool upperCase) const
 string IntX::ToString(const UInt32 numberBase, const string &alphabet) const
 {
 	StrRepHelper::AssertAlphabet(alphabet, numberBase);
-	return StringConvertManager::GetStringConverter(settings.getToStringMode())->ToString(*this, numberBase, alphabet);
+	return StringConvertManager::GetStringConverter(getSettings()->getToStringMode())->ToString(*this, numberBase, alphabet);
 } // end function ToString
 
 
@@ -376,11 +392,8 @@ void IntX::Normalize()
 {
 	if (this->digits.size() > length)
 	{
-		vector<UInt32> newDigits(length);
-		memcpy(&newDigits[0], &digits[0], sizeof(UInt32) * length);
-		this->digits = vector<UInt32>(newDigits);
-		// alternative
-		// digits.resize(length);
+		digits.resize(length);
+		digits.shrink_to_fit();
 	} // end if
 
 	if (length == 0)
@@ -398,7 +411,7 @@ void IntX::Normalize()
 /// <param name="negative">Is negative integer.</param>
 void IntX::GetInternalState(vector<UInt32> &digitsTo, bool &negativeTo) const
 {
-	digitsTo = vector<UInt32>(this->digits);
+	digitsTo.assign(this->digits.begin(), this->digits.begin() + this->length);
 	negativeTo = this->negative;
 } // end function GetInternalState
 
@@ -568,6 +581,23 @@ IntX IntX::Bezoutsidentity(const IntX &int1, const IntX &int2, IntX &bezOne, Int
 	return OpHelper::Bezoutsidentity(int1, int2, bezOne, bezTwo);
 } // end function Bezoutsidentity
 
+void IntX::MultiplyAdd(IntX &result, const IntX &int1, const IntX &int2, const IntX &int3,
+	const bool negateProduct, const bool subtract)
+{
+	OpHelper::MultiplyAdd(result, int1, int2, int3, negateProduct, subtract);
+} // end function MultiplyAdd
+
+void IntX::MultiplyModulo(IntX &result, const IntX &int1, const IntX &int2, const IntX &modulus)
+{
+	OpHelper::MultiplyModulo(result, int1, int2, modulus);
+} // end function MultiplyModulo
+
+void IntX::ShiftAdd(IntX &result, const IntX &intX, const long long shift, const IntX &int3,
+	const bool negateShifted, const bool subtract)
+{
+	OpHelper::ShiftAdd(result, intX, shift, int3, negateShifted, subtract);
+} // end function ShiftAdd
+
 /// <summary>
 /// Checks if a <see cref="TIntX" /> object is Probably Prime using MillerRabin primality test.
 /// </summary>
@@ -797,11 +827,26 @@ IntX IntX::Pow(const IntX &value, const UInt32 power, MultiplyMode mode)
 // assignment operator
 const IntX &IntX::operator =(const IntX &value)
 {
-	if(*this != value)
+	if (this != &value)
 		InitFromIntX(value);
 	return *this;
 } // end function operator=
 
+// move assignment operator
+IntX &IntX::operator =(IntX &&value) noexcept
+{
+	if (this != &value)
+	{
+		digits = std::move(value.digits);
+		length = value.length;
+		negative = value.negative;
+
+		value.length = 0;
+		value.negative = false;
+	} // end if
+	return *this;
+} // end function operator=
+
 
 //==================================================================
 //  operator==
@@ -908,185 +953,267 @@ bool IntX::operator<=(const IntX &int2) const
 //  operator+ and operator-
 //==================================================================
 
-IntX IntX::operator+(const IntX &int2) const
+IntX IntX::operator+(const IntX &int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end function operator+
 
-IntX IntX::operator+(const int int2) const
+IntX IntX::operator+(const IntX &int2) &&
+{
+	OpHelper::AddSubInPlace(*this, int2, false);
+	return std::move(*this);
+} // end function operator+
+
+IntX IntX::operator+(const int int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end operator +
 
-IntX IntX::operator+(const UInt32 int2) const
+IntX IntX::operator+(const int int2) &&
+{
+	return std::move(*this) + IntX(int2);
+} // end operator +
+
+IntX IntX::operator+(const UInt32 int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end operator +
 
-IntX IntX::operator+(const unsigned long int2) const
+IntX IntX::operator+(const UInt32 int2) &&
+{
+	return std::move(*this) + IntX(int2);
+} // end operator +
+
+IntX IntX::operator+(const unsigned long int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end operator +
 
-IntX IntX::operator+(const long long int2) const
+IntX IntX::operator+(const unsigned long int2) &&
+{
+	return std::move(*this) + IntX(int2);
+} // end operator +
+
+IntX IntX::operator+(const long long int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end operator +
 
-IntX IntX::operator+(const UInt64 int2) const
+IntX IntX::operator+(const long long int2) &&
+{
+	return std::move(*this) + IntX(int2);
+} // end operator +
+
+IntX IntX::operator+(const UInt64 int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end operator +
 
-IntX IntX::operator+(const double int2) const
+IntX IntX::operator+(const UInt64 int2) &&
+{
+	return std::move(*this) + IntX(int2);
+} // end operator +
+
+IntX IntX::operator+(const double int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end operator +
 
-IntX IntX::operator+(const string &int2) const
+IntX IntX::operator+(const double int2) &&
+{
+	return std::move(*this) + IntX(int2);
+} // end operator +
+
+IntX IntX::operator+(const string &int2) const &
 {
 	return OpHelper::AddSub(*this, int2, false);
 } // end operator +
+
+IntX IntX::operator+(const string &int2) &&
+{
+	return std::move(*this) + IntX(int2);
+} // end operator +
 //
 //
 //
-IntX IntX::operator+=(const IntX &int2)
+IntX &IntX::operator+=(const IntX &int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end function operator+=
 
-IntX IntX::operator+=(const int int2)
+IntX &IntX::operator+=(const int int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end operator +=
 
-IntX IntX::operator+=(const UInt32 int2)
+IntX &IntX::operator+=(const UInt32 int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end operator +=
 
-IntX IntX::operator+=(const unsigned long int2)
+IntX &IntX::operator+=(const unsigned long int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end operator +=
 
-IntX IntX::operator+=(const long long int2)
+IntX &IntX::operator+=(const long long int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end operator +=
 
-IntX IntX::operator+=(const UInt64 int2)
+IntX &IntX::operator+=(const UInt64 int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end operator +=
 
-IntX IntX::operator+=(const double int2)
+IntX &IntX::operator+=(const double int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end operator +=
 
-IntX IntX::operator+=(const string &int2)
+IntX &IntX::operator+=(const string &int2)
 {
-	*this = OpHelper::AddSub(*this, int2, false);
+	OpHelper::AddSubInPlace(*this, int2, false);
 	return *this;
 } // end operator +=
 //
 //
 //
-IntX IntX::operator-(const IntX &int2) const
+IntX IntX::operator-(const IntX &int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end function operator-
 
-IntX IntX::operator-(const int int2) const
+IntX IntX::operator-(const IntX &int2) &&
+{
+	OpHelper::AddSubInPlace(*this, int2, true);
+	return std::move(*this);
+} // end function operator-
+
+IntX IntX::operator-(const int int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end operator -
 
-IntX IntX::operator-(const UInt32 int2) const
+IntX IntX::operator-(const int int2) &&
+{
+	return std::move(*this) - IntX(int2);
+} // end operator -
+
+IntX IntX::operator-(const UInt32 int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end operator -
 
-IntX IntX::operator-(const unsigned long int2) const
+IntX IntX::operator-(const UInt32 int2) &&
+{
+	return std::move(*this) - IntX(int2);
+} // end operator -
+
+IntX IntX::operator-(const unsigned long int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end operator -
 
-IntX IntX::operator-(const long long int2) const
+IntX IntX::operator-(const unsigned long int2) &&
+{
+	return std::move(*this) - IntX(int2);
+} // end operator -
+
+IntX IntX::operator-(const long long int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end operator -
 
-IntX IntX::operator-(const UInt64 int2) const
+IntX IntX::operator-(const long long int2) &&
+{
+	return std::move(*this) - IntX(int2);
+} // end operator -
+
+IntX IntX::operator-(const UInt64 int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end operator -
 
-IntX IntX::operator-(const double int2) const
+IntX IntX::operator-(const UInt64 int2) &&
+{
+	return std::move(*this) - IntX(int2);
+} // end operator -
+
+IntX IntX::operator-(const double int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end operator -
 
-IntX IntX::operator-(const string &int2) const
+IntX IntX::operator-(const double int2) &&
+{
+	return std::move(*this) - IntX(int2);
+} // end operator -
+
+IntX IntX::operator-(const string &int2) const &
 {
 	return OpHelper::AddSub(*this, int2, true);
 } // end operator -
+
+IntX IntX::operator-(const string &int2) &&
+{
+	return std::move(*this) - IntX(int2);
+} // end operator -
 //
 //
 //
-IntX IntX::operator-=(const IntX &int2)
+IntX &IntX::operator-=(const IntX &int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end function operator-=
 
-IntX IntX::operator-=(const int int2)
+IntX &IntX::operator-=(const int int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end operator -=
 
-IntX IntX::operator-=(const UInt32 int2)
+IntX &IntX::operator-=(const UInt32 int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end operator -=
 
-IntX IntX::operator-=(const unsigned long int2)
+IntX &IntX::operator-=(const unsigned long int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end operator -=
 
-IntX IntX::operator-=(const long long int2)
+IntX &IntX::operator-=(const long long int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end operator -=
 
-IntX IntX::operator-=(const UInt64 int2)
+IntX &IntX::operator-=(const UInt64 int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end operator -=
 
-IntX IntX::operator-=(const double int2)
+IntX &IntX::operator-=(const double int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end operator -=
 
-IntX IntX::operator-=(const string &int2)
+IntX &IntX::operator-=(const string &int2)
 {
-	*this = OpHelper::AddSub(*this, int2, true);
+	OpHelper::AddSubInPlace(*this, int2, true);
 	return *this;
 } // end operator -=
 
@@ -1094,93 +1221,134 @@ IntX IntX::operator-=(const string &int2)
 //  operator* / *=
 //==================================================================
 
-IntX IntX::operator*(const IntX &int2) const
+IntX IntX::operator*(const IntX &int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end function operator*
 
-IntX IntX::operator*(const int int2) const
+IntX IntX::operator*(const IntX &int2) &&
+{
+	OpHelper::MultiplyInPlace(*this, int2);
+	return std::move(*this);
+} // end function operator*
+
+IntX IntX::operator*(const int int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end operator *
 
-IntX IntX::operator*(const UInt32 int2) const
+IntX IntX::operator*(const int int2) &&
+{
+	return std::move(*this) * IntX(int2);
+} // end operator *
+
+IntX IntX::operator*(const UInt32 int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end operator *
 
-IntX IntX::operator*(const unsigned long int2) const
+IntX IntX::operator*(const UInt32 int2) &&
+{
+	return std::move(*this) * IntX(int2);
+} // end operator *
+
+IntX IntX::operator*(const unsigned long int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end operator *
 
-IntX IntX::operator*(const long long int2) const
+IntX IntX::operator*(const unsigned long int2) &&
+{
+	return std::move(*this) * IntX(int2);
+} // end operator *
+
+IntX IntX::operator*(const long long int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end operator *
 
-IntX IntX::operator*(const UInt64 int2) const
+IntX IntX::operator*(const long long int2) &&
+{
+	return std::move(*this) * IntX(int2);
+} // end operator *
+
+IntX IntX::operator*(const UInt64 int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end operator *
 
-IntX IntX::operator*(const double int2) const
+IntX IntX::operator*(const UInt64 int2) &&
+{
+	return std::move(*this) * IntX(int2);
+} // end operator *
+
+IntX IntX::operator*(const double int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end operator *
 
-IntX IntX::operator*(const string &int2) const
+IntX IntX::operator*(const double int2) &&
+{
+	return std::move(*this) * IntX(int2);
+} // end operator *
+
+IntX IntX::operator*(const string &int2) const &
 {
 	return MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
 } // end operator *
+
+IntX IntX::operator*(const string &int2) &&
+{
+	return std::move(*this) * IntX(int2);
+} // end operator *
 //
 //
 //
-IntX IntX::operator*=(const IntX &int2)
+IntX &IntX::operator*=(const IntX &int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end function operator*=
 
-IntX IntX::operator*=(const int int2)
+IntX &IntX::operator*=(const int int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end operator *=
 
-IntX IntX::operator*=(const UInt32 int2)
+IntX &IntX::operator*=(const UInt32 int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end operator *=
 
-IntX IntX::operator*=(const unsigned long int2)
+IntX &IntX::operator*=(const unsigned long int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end operator *=
 
-IntX IntX::operator*=(const long long int2)
+IntX &IntX::operator*=(const long long int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end operator *=
 
-IntX IntX::operator*=(const UInt64 int2)
+IntX &IntX::operator*=(const UInt64 int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end operator *=
 
-IntX IntX::operator*=(const double int2)
+IntX &IntX::operator*=(const double int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end operator *=
 
-IntX IntX::operator*=(const string &int2)
+IntX &IntX::operator*=(const string &int2)
 {
-	*this = MultiplyManager::GetCurrentMultiplier()->Multiply(*this, int2);
+	OpHelper::MultiplyInPlace(*this, int2);
 	return *this;
 } // end operator *=
 
@@ -1248,56 +1416,56 @@ IntX IntX::operator/(const string &int2) const
 //
 //
 //
-IntX IntX::operator/=(const IntX &int2)
+IntX &IntX::operator/=(const IntX &int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
 	return *this;
 } // end function operator/=
 
-IntX IntX::operator/=(const int int2)
+IntX &IntX::operator/=(const int int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
 	return *this;
 } // end operator /=
 
-IntX IntX::operator/=(const UInt32 int2)
+IntX &IntX::operator/=(const UInt32 int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
 	return *this;
 } // end operator /=
 
-IntX IntX::operator/=(const unsigned long int2)
+IntX &IntX::operator/=(const unsigned long int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
 	return *this;
 } // end operator /=
 
-IntX IntX::operator/=(const long long int2)
+IntX &IntX::operator/=(const long long int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
 	return *this;
 } // end operator /=
 
-IntX IntX::operator/=(const UInt64 int2)
+IntX &IntX::operator/=(const UInt64 int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
 	return *this;
 } // end operator /=
 
-IntX IntX::operator/=(const double int2)
+IntX &IntX::operator/=(const double int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
 	return *this;
 } // end operator /=
 
-IntX IntX::operator/=(const string &int2)
+IntX &IntX::operator/=(const string &int2)
 {
 	IntX modRes;
 	*this = DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfDiv);
@@ -1364,7 +1532,7 @@ IntX IntX::operator%(const string &int2) const
 //
 //
 //
-IntX IntX::operator%=(const IntX &int2)
+IntX &IntX::operator%=(const IntX &int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1372,7 +1540,7 @@ IntX IntX::operator%=(const IntX &int2)
 	return *this;
 } // end function operator%=
 
-IntX IntX::operator%=(const int int2)
+IntX &IntX::operator%=(const int int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1380,7 +1548,7 @@ IntX IntX::operator%=(const int int2)
 	return *this;
 } // end operator %=
 
-IntX IntX::operator%=(const UInt32 int2)
+IntX &IntX::operator%=(const UInt32 int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1388,7 +1556,7 @@ IntX IntX::operator%=(const UInt32 int2)
 	return *this;
 } // end operator %=
 
-IntX IntX::operator%=(const unsigned long int2)
+IntX &IntX::operator%=(const unsigned long int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1396,7 +1564,7 @@ IntX IntX::operator%=(const unsigned long int2)
 	return *this;
 } // end operator %=
 
-IntX IntX::operator%=(const long long int2)
+IntX &IntX::operator%=(const long long int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1404,7 +1572,7 @@ IntX IntX::operator%=(const long long int2)
 	return *this;
 } // end operator %=
 
-IntX IntX::operator%=(const UInt64 int2)
+IntX &IntX::operator%=(const UInt64 int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1412,7 +1580,7 @@ IntX IntX::operator%=(const UInt64 int2)
 	return *this;
 } // end operator %=
 
-IntX IntX::operator%=(const double int2)
+IntX &IntX::operator%=(const double int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1420,7 +1588,7 @@ IntX IntX::operator%=(const double int2)
 	return *this;
 } // end operator %=
 
-IntX IntX::operator%=(const string &int2)
+IntX &IntX::operator%=(const string &int2)
 {
 	IntX modRes;
 	DivideManager::GetCurrentDivider()->DivMod(*this, int2, modRes, DivModResultFlags::dmrfMod);
@@ -1454,21 +1622,39 @@ IntX operator<<(const IntX &intX, const long long shift)
 	return OpHelper::Sh(intX, shift, true);
 } // end function operator<<
 
-IntX operator<<=(IntX &int1, const UInt32 shift)
+IntX operator<<(IntX &&intX, const UInt32 shift)
 {
-	int1 = int1 << shift;
+	OpHelper::ShInPlace(intX, shift, true);
+	return std::move(intX);
+} // end function operator<<
+
+IntX operator<<(IntX &&intX, const int shift)
+{
+	OpHelper::ShInPlace(intX, shift, true);
+	return std::move(intX);
+} // end function operator<<
+
+IntX operator<<(IntX &&intX, const long long shift)
+{
+	OpHelper::ShInPlace(intX, shift, true);
+	return std::move(intX);
+} // end function operator<<
+
+IntX &operator<<=(IntX &int1, const UInt32 shift)
+{
+	OpHelper::ShInPlace(int1, shift, true);
 	return int1;
 } // end operator <<=
 
-IntX operator<<=(IntX &int1, const int shift)
+IntX &operator<<=(IntX &int1, const int shift)
 {
-	int1 = int1 << shift;
+	OpHelper::ShInPlace(int1, shift, true);
 	return int1;
 } // end operator <<=
 
-IntX operator<<=(IntX &int1, const long long shift)
+IntX &operator<<=(IntX &int1, const long long shift)
 {
-	int1 = int1 << shift;
+	OpHelper::ShInPlace(int1, shift, true);
 	return int1;
 } // end operator <<=
 
@@ -1494,21 +1680,39 @@ IntX operator>>(const IntX &intX, const long long shift)
 	return OpHelper::Sh(intX, shift, false);
 } // end function operator>>
 
-IntX operator>>=(IntX &int1, const UInt32 shift)
+IntX operator>>(IntX &&intX, const UInt32 shift)
+{
+	OpHelper::ShInPlace(intX, shift, false);
+	return std::move(intX);
+} // end function operator>>
+
+IntX operator>>(IntX &&intX, const int shift)
+{
+	OpHelper::ShInPlace(intX, shift, false);
+	return std::move(intX);
+} // end function operator>>
+
+IntX operator>>(IntX &&intX, const long long shift)
+{
+	OpHelper::ShInPlace(intX, shift, false);
+	return std::move(intX);
+} // end function operator>>
+
+IntX &operator>>=(IntX &int1, const UInt32 shift)
 {
-	int1 = int1 >> shift;
+	OpHelper::ShInPlace(int1, shift, false);
 	return int1;
 } // end operator >>=
 
-IntX operator>>=(IntX &int1, const int shift)
+IntX &operator>>=(IntX &int1, const int shift)
 {
-	int1 = int1 >> shift;
+	OpHelper::ShInPlace(int1, shift, false);
 	return int1;
 } // end operator >>=
 
-IntX operator>>=(IntX &int1, const long long shift)
+IntX &operator>>=(IntX &int1, const long long shift)
 {
-	int1 = int1 >> shift;
+	OpHelper::ShInPlace(int1, shift, false);
 	return int1;
 } // end operator >>=
 
@@ -1636,51 +1840,51 @@ IntX IntX::operator|(const string &int2) const
 //
 //
 //
-IntX IntX::operator|=(const IntX &int2)
+IntX &IntX::operator|=(const IntX &int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end function operator|=
 
-IntX IntX::operator|=(const int int2)
+IntX &IntX::operator|=(const int int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end operator |=
 
-IntX IntX::operator|=(const UInt32 int2)
+IntX &IntX::operator|=(const UInt32 int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end operator |=
 
-IntX IntX::operator|=(const unsigned long int2)
+IntX &IntX::operator|=(const unsigned long int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end operator |=
 
-IntX IntX::operator|=(const long long int2)
+IntX &IntX::operator|=(const long long int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end operator |=
 
-IntX IntX::operator|=(const UInt64 int2)
+IntX &IntX::operator|=(const UInt64 int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end operator |=
 
-IntX IntX::operator|=(const double int2)
+IntX &IntX::operator|=(const double int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end operator |=
 
-IntX IntX::operator|=(const string &int2)
+IntX &IntX::operator|=(const string &int2)
 {
-	*this = OpHelper::BitwiseOr(*this, int2);
+	OpHelper::BitwiseOrInPlace(*this, int2);
 	return *this;
 } // end operator |=
 //
@@ -1728,51 +1932,51 @@ IntX IntX::operator&(const string &int2) const
   //
   //
   //
-IntX IntX::operator&=(const IntX &int2)
+IntX &IntX::operator&=(const IntX &int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end function operator&=
 
-IntX IntX::operator&=(const int int2)
+IntX &IntX::operator&=(const int int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end operator &=
 
-IntX IntX::operator&=(const UInt32 int2)
+IntX &IntX::operator&=(const UInt32 int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end operator &=
 
-IntX IntX::operator&=(const unsigned long int2)
+IntX &IntX::operator&=(const unsigned long int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end operator &=
 
-IntX IntX::operator&=(const long long int2)
+IntX &IntX::operator&=(const long long int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end operator &=
 
-IntX IntX::operator&=(const UInt64 int2)
+IntX &IntX::operator&=(const UInt64 int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end operator &=
 
-IntX IntX::operator&=(const double int2)
+IntX &IntX::operator&=(const double int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end operator &=
 
-IntX IntX::operator&=(const string &int2)
+IntX &IntX::operator&=(const string &int2)
 {
-	*this = OpHelper::BitwiseAnd(*this, int2);
+	OpHelper::BitwiseAndInPlace(*this, int2);
 	return *this;
 } // end operator &=
 //
@@ -1820,51 +2024,51 @@ IntX IntX::operator^(const string &int2) const
   //
   //
   //
-IntX IntX::operator^=(const IntX &int2)
+IntX &IntX::operator^=(const IntX &int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end function operator^=
 
-IntX IntX::operator^=(const int int2)
+IntX &IntX::operator^=(const int int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end operator ^=
 
-IntX IntX::operator^=(const UInt32 int2)
+IntX &IntX::operator^=(const UInt32 int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end operator ^=
 
-IntX IntX::operator^=(const unsigned long int2)
+IntX &IntX::operator^=(const unsigned long int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end operator ^=
 
-IntX IntX::operator^=(const long long int2)
+IntX &IntX::operator^=(const long long int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end operator ^=
 
-IntX IntX::operator^=(const UInt64 int2)
+IntX &IntX::operator^=(const UInt64 int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end operator ^=
 
-IntX IntX::operator^=(const double int2)
+IntX &IntX::operator^=(const double int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end operator ^=
 
-IntX IntX::operator^=(const string &int2)
+IntX &IntX::operator^=(const string &int2)
 {
-	*this = OpHelper::ExclusiveOr(*this, int2);
+	OpHelper::ExclusiveOrInPlace(*this, int2);
 	return *this;
 } // end operator ^=
 
@@ -1949,9 +2153,8 @@ IntX::operator double() const
 	
 	UInt64 man, h, m, l;
 	int exp, sign, lLength, z;
-	vector<UInt32> bits;
+	const DigitsVector &bits = this->digits;
 
-	bits = this->digits;
 	lLength = this->length;
 
 	if (this->IsZero()) return 0;
@@ -1997,7 +2200,7 @@ IntX::operator double() const
 void IntX::InitFromZero()
 {
 	this->length = 0;
-	digits = vector<UInt32>(0);
+	digits.clear();
 } // end function InitFromZero
 
 /// <summary>
@@ -2016,13 +2219,13 @@ void IntX::InitFromUlong(const UInt64 value)
 	if (high == 0)
 	{
 		this->length = 1;
-		digits = vector<UInt32>(this->length);
+		digits.resize(this->length);
 		digits[0] = low;
 	} // end if
 	else
 	{
 		this->length = 2;
-		digits = vector<UInt32>(this->length);
+		digits.resize(this->length);
 		digits[0] = low;
 		digits[1] = high;
 	} // end else
@@ -2037,14 +2240,14 @@ void IntX::InitFromUlong(const UInt64 value)
 void IntX::InitFromIntX(const IntX &value)
 {
 	this->length = value.length;
-	this->digits = vector<UInt32>(value.digits);
+	this->digits = value.digits;
 	this->negative = value.negative;
 } // end function InitFromIntX
 
 void IntX::InitFromDigits(const vector<UInt32> &vdigits, const bool vNegative, const UInt32 vlength)
 {
 	length = vlength;
-	digits = vector<UInt32>(vdigits);
+	digits.assign(vdigits.data(), vdigits.data() + vdigits.size());
 
 	if (length != 0)
 	{
@@ -2062,7 +2265,7 @@ void IntX::InitFromDigits(const vector<UInt32> &vdigits, const bool vNegative, c
 void IntX::InitFromDigits(const UInt32 *vdigits, const bool vNegative, const UInt32 vlength)
 {
 	length = vlength;
-	digits = vector<UInt32>(vdigits, vdigits + sizeof(vdigits) / sizeof(vdigits[0]));
+	digits.assign(vdigits, vdigits + vlength);
 
 	if (length != 0)
 	{
@@ -2078,7 +2281,7 @@ void IntX::InitFromDigits(const UInt32 *vdigits, const bool vNegative, const UIn
 // Frees extra space not used by digits only if auto-normalize is set for the instance.
 void IntX::TryNormalize()
 {
-	if (settings.getAutoNormalize())
+	if (getSettings()->getAutoNormalize())
 	{
 		Normalize();
 	} // end if
@@ -10,11 +10,13 @@ typedef unsigned int UInt32;
 #include <string>
 #include <cstring>
 #include <vector>
+#include <utility>
 
 #include "Settings/IntXGlobalSettings.h"
 #include "Settings/IntXSettings.h"
 
 #include "Utils/Enums.h"
+#include "Utils/DigitsVector.h"
 
 using namespace std;
 
@@ -30,6 +32,8 @@ class StringConverterBase;
 class MultiplierBase;
 class FastStringConverter;
 
+template <typename TExpr> class IntXExpression;
+
 
 class IntX
 {
@@ -46,6 +50,8 @@ class IntX
 	friend class DividerBase;
 	friend class StringConverterBase;
 	friend class FastStringConverter;
+	friend class IntXView;
+	friend class ToomCookMultiplier;
 
 public:
 	//==================================================================
@@ -60,7 +66,7 @@ public:
 	//==================================================================
 
 	// Creates new big integer with zero value.
-	IntX() : digits(0), length(0), negative(false)
+	IntX() : digits(), length(0), negative(false)
 	{
 		// Empty
 	} // end default Constructor  
@@ -139,11 +145,36 @@ public:
 	/// <param name="value">Value to copy from.</param>
 	IntX(const IntX &value);
 
-	IntX(const vector<UInt32> &digits, const bool negative)
+	/// <summary>
+	/// Move constructor.
+	/// Takes over digits buffer of <paramref name="value" /> and leaves it with zero value.
+	/// </summary>
+	/// <param name="value">Value to move from.</param>
+	IntX(IntX &&value) noexcept;
+
+	/// <summary>
+	/// Creates new big integer by evaluating lazy expression (see IntXExpression.h).
+	/// </summary>
+	/// <param name="expr">Expression to evaluate.</param>
+	template <typename TExpr>
+	IntX(const IntXExpression<TExpr> &expr) : IntX()
+	{
+		expr.Self().EvaluateTo(*this);
+	} // end constructor
+
+	IntX(const vector<UInt32> &digits, const bool negative) : IntX()
 	{
 		InitFromDigits(digits, negative, digits.size());
 	} // end cctor
 
+	/// <summary>
+	/// Creates new big integer which takes over given digits buffer (no digits are copied).
+	/// Digit with lower index has less weight, leading zero digits are not counted.
+	/// </summary>
+	/// <param name="digits">Digits buffer to adopt (left empty).</param>
+	/// <param name="negative">True if this number is negative.</param>
+	IntX(DigitsVector &&digits, const bool negative);
+
 private:
 	
 	/// <summary>
@@ -192,8 +223,13 @@ public:
 		return length > 0 && (digits[0] & 1) == 1;
 	} // end function IsOdd
 
-	IntXSettings* getSettings()
+	/// <summary>
+	/// Gets settings used by all big integers on the calling thread.
+	/// Values which were not set there are taken from <see cref="getGlobalSettings" />.
+	/// </summary>
+	static IntXSettings* getSettings()
 	{
+		static thread_local IntXSettings settings(globalSettings);
 		return &settings;
 	} // end function getSettings
 
@@ -469,6 +505,46 @@ public:
 	/// <seealso href="https://en.wikipedia.org/wiki/Extended_Euclidean_algorithm#Pseudocode">[Bzout's identity Pseudocode using Extended Euclidean algorithm]</seealso>
 	static IntX Bezoutsidentity(const IntX &int1, const IntX &int2, IntX &bezOne, IntX &bezTwo);
 
+	/// <summary>
+	/// Calculates <paramref name="int1" /> * <paramref name="int2" /> + <paramref name="int3" /> into
+	/// <paramref name="result" /> without creating intermediate <see cref="IntX" /> objects.
+	/// Any operand may be the same object as <paramref name="result" />.
+	/// </summary>
+	/// <param name="result">Resulting big integer.</param>
+	/// <param name="int1">First multiplier.</param>
+	/// <param name="int2">Second multiplier.</param>
+	/// <param name="int3">Addend.</param>
+	/// <param name="negateProduct">If true product is subtracted instead of being added.</param>
+	/// <param name="subtract">If true <paramref name="int3" /> is subtracted instead of being added.</param>
+	static void MultiplyAdd(IntX &result, const IntX &int1, const IntX &int2, const IntX &int3,
+		const bool negateProduct = false, const bool subtract = false);
+
+	/// <summary>
+	/// Calculates (<paramref name="int1" /> * <paramref name="int2" />) % <paramref name="modulus" /> into
+	/// <paramref name="result" /> without creating intermediate <see cref="IntX" /> objects.
+	/// Any operand may be the same object as <paramref name="result" />.
+	/// </summary>
+	/// <param name="result">Resulting big integer.</param>
+	/// <param name="int1">First multiplier.</param>
+	/// <param name="int2">Second multiplier.</param>
+	/// <param name="modulus">Divider.</param>
+	/// <exception cref="DivideByZeroException"><paramref name="modulus" /> equals zero.</exception>
+	static void MultiplyModulo(IntX &result, const IntX &int1, const IntX &int2, const IntX &modulus);
+
+	/// <summary>
+	/// Calculates (<paramref name="intX" /> &lt;&lt; <paramref name="shift" />) + <paramref name="int3" /> into
+	/// <paramref name="result" /> without creating intermediate <see cref="IntX" /> objects.
+	/// Any operand may be the same object as <paramref name="result" />.
+	/// </summary>
+	/// <param name="result">Resulting big integer.</param>
+	/// <param name="intX">Big integer to shift.</param>
+	/// <param name="shift">Bits count to shift to the left (negative value means right shift).</param>
+	/// <param name="int3">Addend.</param>
+	/// <param name="negateShifted">If true shifted value is subtracted instead of being added.</param>
+	/// <param name="subtract">If true <paramref name="int3" /> is subtracted instead of being added.</param>
+	static void ShiftAdd(IntX &result, const IntX &intX, const long long shift, const IntX &int3,
+		const bool negateShifted = false, const bool subtract = false);
+
 	/// <summary>
 	/// Checks if a <see cref="IntX" /> object is Probably Prime using MillerRabin primality test.
 	/// </summary>
@@ -628,6 +704,17 @@ public:
 	
 	// assignment operator
 	const IntX &operator =(const IntX &value);
+
+	// move assignment operator
+	IntX &operator =(IntX &&value) noexcept;
+
+	// evaluates lazy expression (see IntXExpression.h) right into this object
+	template <typename TExpr>
+	IntX &operator =(const IntXExpression<TExpr> &expr)
+	{
+		expr.Self().EvaluateTo(*this);
+		return *this;
+	} // end function operator=
 	
 	//==================================================================
 	//  operator==
@@ -789,23 +876,32 @@ public:
 	/// <param name="int1">First big integer.</param>
 	/// <param name="int2">Second big integer.</param>
 	/// <returns>Addition result.</returns>
-	IntX operator+(const IntX &int2) const;
-	IntX operator+(const int int2) const;
-	IntX operator+(const UInt32 int2) const;
-	IntX operator+(const unsigned long int2) const;
-	IntX operator+(const long long int2) const;
-	IntX operator+(const UInt64 int2) const;
-	IntX operator+(const double int2) const;
-	IntX operator+(const string &int2) const;
-
-	IntX operator+=(const IntX &int2);
-	IntX operator+=(const int int2);
-	IntX operator+=(const UInt32 int2);
-	IntX operator+=(const unsigned long int2);
-	IntX operator+=(const long long int2);
-	IntX operator+=(const UInt64 int2);
-	IntX operator+=(const double int2);
-	IntX operator+=(const string &int2);
+	/// <remarks>Overloads taking an rvalue first operand reuse its digits buffer.</remarks>
+	IntX operator+(const IntX &int2) const &;
+	IntX operator+(const IntX &int2) &&;
+	IntX operator+(const int int2) const &;
+	IntX operator+(const int int2) &&;
+	IntX operator+(const UInt32 int2) const &;
+	IntX operator+(const UInt32 int2) &&;
+	IntX operator+(const unsigned long int2) const &;
+	IntX operator+(const unsigned long int2) &&;
+	IntX operator+(const long long int2) const &;
+	IntX operator+(const long long int2) &&;
+	IntX operator+(const UInt64 int2) const &;
+	IntX operator+(const UInt64 int2) &&;
+	IntX operator+(const double int2) const &;
+	IntX operator+(const double int2) &&;
+	IntX operator+(const string &int2) const &;
+	IntX operator+(const string &int2) &&;
+
+	IntX &operator+=(const IntX &int2);
+	IntX &operator+=(const int int2);
+	IntX &operator+=(const UInt32 int2);
+	IntX &operator+=(const unsigned long int2);
+	IntX &operator+=(const long long int2);
+	IntX &operator+=(const UInt64 int2);
+	IntX &operator+=(const double int2);
+	IntX &operator+=(const string &int2);
 
 	/// <summary>
 	/// Subtracts one <see cref="IntX" /> object from another.
@@ -813,23 +909,32 @@ public:
 	/// <param name="int1">First big integer.</param>
 	/// <param name="int2">Second big integer.</param>
 	/// <returns>Subtraction result.</returns>
-	IntX operator-(const IntX &int2) const;
-	IntX operator-(const int int2) const;
-	IntX operator-(const UInt32 int2) const;
-	IntX operator-(const unsigned long int2) const;
-	IntX operator-(const long long int2) const;
-	IntX operator-(const UInt64 int2) const;
-	IntX operator-(const double int2) const;
-	IntX operator-(const string &int2) const;
-
-	IntX operator-=(const IntX &int2);
-	IntX operator-=(const int int2);
-	IntX operator-=(const UInt32 int2);
-	IntX operator-=(const unsigned long int2);
-	IntX operator-=(const long long int2);
-	IntX operator-=(const UInt64 int2);
-	IntX operator-=(const double int2);
-	IntX operator-=(const string &int2);		
+	/// <remarks>Overloads taking an rvalue first operand reuse its digits buffer.</remarks>
+	IntX operator-(const IntX &int2) const &;
+	IntX operator-(const IntX &int2) &&;
+	IntX operator-(const int int2) const &;
+	IntX operator-(const int int2) &&;
+	IntX operator-(const UInt32 int2) const &;
+	IntX operator-(const UInt32 int2) &&;
+	IntX operator-(const unsigned long int2) const &;
+	IntX operator-(const unsigned long int2) &&;
+	IntX operator-(const long long int2) const &;
+	IntX operator-(const long long int2) &&;
+	IntX operator-(const UInt64 int2) const &;
+	IntX operator-(const UInt64 int2) &&;
+	IntX operator-(const double int2) const &;
+	IntX operator-(const double int2) &&;
+	IntX operator-(const string &int2) const &;
+	IntX operator-(const string &int2) &&;
+
+	IntX &operator-=(const IntX &int2);
+	IntX &operator-=(const int int2);
+	IntX &operator-=(const UInt32 int2);
+	IntX &operator-=(const unsigned long int2);
+	IntX &operator-=(const long long int2);
+	IntX &operator-=(const UInt64 int2);
+	IntX &operator-=(const double int2);
+	IntX &operator-=(const string &int2);		
 	
 	//==================================================================
 	//  operator* / *=
@@ -842,23 +947,32 @@ public:
 	/// <param name="int1">First big integer.</param>
 	/// <param name="int2">Second big integer.</param>
 	/// <returns>Multiply result.</returns>
-	IntX operator*(const IntX &int2) const;
-	IntX operator*(const int int2) const;
-	IntX operator*(const UInt32 int2) const;
-	IntX operator*(const unsigned long int2) const;
-	IntX operator*(const long long int2) const;
-	IntX operator*(const UInt64 int2) const;
-	IntX operator*(const double int2) const;
-	IntX operator*(const string &int2) const;
-
-	IntX operator*=(const IntX &int2);
-	IntX operator*=(const int int2);
-	IntX operator*=(const UInt32 int2);
-	IntX operator*=(const unsigned long int2);
-	IntX operator*=(const long long int2);
-	IntX operator*=(const UInt64 int2);
-	IntX operator*=(const double int2);
-	IntX operator*=(const string &int2);
+	/// <remarks>Overloads taking an rvalue first operand reuse its digits buffer.</remarks>
+	IntX operator*(const IntX &int2) const &;
+	IntX operator*(const IntX &int2) &&;
+	IntX operator*(const int int2) const &;
+	IntX operator*(const int int2) &&;
+	IntX operator*(const UInt32 int2) const &;
+	IntX operator*(const UInt32 int2) &&;
+	IntX operator*(const unsigned long int2) const &;
+	IntX operator*(const unsigned long int2) &&;
+	IntX operator*(const long long int2) const &;
+	IntX operator*(const long long int2) &&;
+	IntX operator*(const UInt64 int2) const &;
+	IntX operator*(const UInt64 int2) &&;
+	IntX operator*(const double int2) const &;
+	IntX operator*(const double int2) &&;
+	IntX operator*(const string &int2) const &;
+	IntX operator*(const string &int2) &&;
+
+	IntX &operator*=(const IntX &int2);
+	IntX &operator*=(const int int2);
+	IntX &operator*=(const UInt32 int2);
+	IntX &operator*=(const unsigned long int2);
+	IntX &operator*=(const long long int2);
+	IntX &operator*=(const UInt64 int2);
+	IntX &operator*=(const double int2);
+	IntX &operator*=(const string &int2);
 	
 	//==================================================================
 	//  operator/ and /= and operator% / %=
@@ -880,14 +994,14 @@ public:
 	IntX operator/(const double int2) const;
 	IntX operator/(const string &int2) const;
 
-	IntX operator/=(const IntX &int2);
-	IntX operator/=(const int int2);
-	IntX operator/=(const UInt32 int2);
-	IntX operator/=(const unsigned long int2);
-	IntX operator/=(const long long int2);
-	IntX operator/=(const UInt64 int2);
-	IntX operator/=(const double int2);
-	IntX operator/=(const string &int2);
+	IntX &operator/=(const IntX &int2);
+	IntX &operator/=(const int int2);
+	IntX &operator/=(const UInt32 int2);
+	IntX &operator/=(const unsigned long int2);
+	IntX &operator/=(const long long int2);
+	IntX &operator/=(const UInt64 int2);
+	IntX &operator/=(const double int2);
+	IntX &operator/=(const string &int2);
 	//
 	//
 	//
@@ -907,14 +1021,14 @@ public:
 	IntX operator%(const double int2) const;
 	IntX operator%(const string &int2) const;
 
-	IntX operator%=(const IntX &int2);
-	IntX operator%=(const int int2);
-	IntX operator%=(const UInt32 int2);
-	IntX operator%=(const unsigned long int2);
-	IntX operator%=(const long long int2);
-	IntX operator%=(const UInt64 int2);
-	IntX operator%=(const double int2);
-	IntX operator%=(const string &int2);
+	IntX &operator%=(const IntX &int2);
+	IntX &operator%=(const int int2);
+	IntX &operator%=(const UInt32 int2);
+	IntX &operator%=(const unsigned long int2);
+	IntX &operator%=(const long long int2);
+	IntX &operator%=(const UInt64 int2);
+	IntX &operator%=(const double int2);
+	IntX &operator%=(const string &int2);
 
 	//==================================================================
 	//  operator<< / <<= and operator>> / >>=
@@ -927,13 +1041,17 @@ public:
 	/// <param name="intX">Big integer.</param>
 	/// <param name="shift">Bits count.</param>
 	/// <returns>Shifting result.</returns>
+	/// <remarks>Overloads taking an rvalue first operand reuse its digits buffer.</remarks>
 	friend IntX operator<<(const IntX &intX, const UInt32 shift);
 	friend IntX operator<<(const IntX &intX, const int shift);
 	friend IntX operator<<(const IntX &intX, const long long shift);
+	friend IntX operator<<(IntX &&intX, const UInt32 shift);
+	friend IntX operator<<(IntX &&intX, const int shift);
+	friend IntX operator<<(IntX &&intX, const long long shift);
 
-	friend IntX operator<<=(IntX &int1, const UInt32 int2);
-	friend IntX operator<<=(IntX &int1, const int int2);
-	friend IntX operator<<=(IntX &int1, const long long int2);
+	friend IntX &operator<<=(IntX &int1, const UInt32 int2);
+	friend IntX &operator<<=(IntX &int1, const int int2);
+	friend IntX &operator<<=(IntX &int1, const long long int2);
 
 	/// <summary>
 	/// Shifts <see cref="IntX" /> object on selected bits count to the right.
@@ -941,13 +1059,17 @@ public:
 	/// <param name="intX">Big integer.</param>
 	/// <param name="shift">Bits count.</param>
 	/// <returns>Shifting result.</returns>
+	/// <remarks>Overloads taking an rvalue first operand reuse its digits buffer.</remarks>
 	friend IntX operator>>(const IntX &intX, const UInt32 shift);
 	friend IntX operator>>(const IntX &intX, const int shift);
 	friend IntX operator>>(const IntX &intX, const long long shift);
+	friend IntX operator>>(IntX &&intX, const UInt32 shift);
+	friend IntX operator>>(IntX &&intX, const int shift);
+	friend IntX operator>>(IntX &&intX, const long long shift);
 
-	friend IntX operator>>=(IntX &int1, const UInt32 int2);
-	friend IntX operator>>=(IntX &int1, const int int2);
-	friend IntX operator>>=(IntX &int1, const long long int2);
+	friend IntX &operator>>=(IntX &int1, const UInt32 int2);
+	friend IntX &operator>>=(IntX &int1, const int int2);
+	friend IntX &operator>>=(IntX &int1, const long long int2);
 
 	//==================================================================
 	//  +, -, ++, -- unary operators
@@ -1021,14 +1143,14 @@ public:
 	IntX operator|(const double int2) const;
 	IntX operator|(const string &int2) const;
 
-	IntX operator|=(const IntX &int2);
-	IntX operator|=(const int int2);
-	IntX operator|=(const UInt32 int2);
-	IntX operator|=(const unsigned long int2);
-	IntX operator|=(const long long int2);
-	IntX operator|=(const UInt64 int2);
-	IntX operator|=(const double int2);
-	IntX operator|=(const string &int2);
+	IntX &operator|=(const IntX &int2);
+	IntX &operator|=(const int int2);
+	IntX &operator|=(const UInt32 int2);
+	IntX &operator|=(const unsigned long int2);
+	IntX &operator|=(const long long int2);
+	IntX &operator|=(const UInt64 int2);
+	IntX &operator|=(const double int2);
+	IntX &operator|=(const string &int2);
 
 	/// <summary>
 	/// Performs bitwise AND for two big integers.
@@ -1045,14 +1167,14 @@ public:
 	IntX operator&(const double int2) const;
 	IntX operator&(const string &int2) const;
 
-	IntX operator&=(const IntX &int2);
-	IntX operator&=(const int int2);
-	IntX operator&=(const UInt32 int2);
-	IntX operator&=(const unsigned long int2);
-	IntX operator&=(const long long int2);
-	IntX operator&=(const UInt64 int2);
-	IntX operator&=(const double int2);
-	IntX operator&=(const string &int2);
+	IntX &operator&=(const IntX &int2);
+	IntX &operator&=(const int int2);
+	IntX &operator&=(const UInt32 int2);
+	IntX &operator&=(const unsigned long int2);
+	IntX &operator&=(const long long int2);
+	IntX &operator&=(const UInt64 int2);
+	IntX &operator&=(const double int2);
+	IntX &operator&=(const string &int2);
 
 	/// <summary>
 	/// Performs bitwise XOR for two big integers.
@@ -1069,14 +1191,14 @@ public:
 	IntX operator^(const double int2) const;
 	IntX operator^(const string &int2) const;
 
-	IntX operator^=(const IntX &int2);
-	IntX operator^=(const int int2);
-	IntX operator^=(const UInt32 int2);
-	IntX operator^=(const unsigned long int2);
-	IntX operator^=(const long long int2);
-	IntX operator^=(const UInt64 int2);
-	IntX operator^=(const double int2);
-	IntX operator^=(const string &int2);
+	IntX &operator^=(const IntX &int2);
+	IntX &operator^=(const int int2);
+	IntX &operator^=(const UInt32 int2);
+	IntX &operator^=(const unsigned long int2);
+	IntX &operator^=(const long long int2);
+	IntX &operator^=(const UInt64 int2);
+	IntX &operator^=(const double int2);
+	IntX &operator^=(const string &int2);
 
 	/// <summary>
 	/// Performs bitwise NOT for big integer.
@@ -1205,11 +1327,12 @@ private:
 	//  Internal fields
 	//==================================================================
 
-	vector<UInt32> digits; // big integer digits
-	UInt32 length = 0; // big integer digits length
-	bool negative = false; // big integer sign ("-" if true)
+	// Fields are packed so that small numbers take 16 bytes (with default INTX_INLINE_DIGITS_COUNT);
+	// settings are not stored in the instance at all (see getSettings).
 
-	IntXSettings settings = IntXSettings(globalSettings);
+	DigitsVector digits; // big integer digits (small numbers are kept inline)
+	UInt32 length : 31; // big integer digits length
+	UInt32 negative : 1; // big integer sign ("-" if true)
 
 	
 }; // end class IntX
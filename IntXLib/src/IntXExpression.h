@@ -0,0 +1,262 @@
+#pragma once
+
+#ifndef INTXEXPRESSION_H
+#define INTXEXPRESSION_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "IntX.h"
+
+using namespace std;
+
+//==================================================================
+//  Lazy expressions over IntX (opt-in).
+//
+//  Wrap an operand into Lazy() to build expression instead of calculating it:
+//
+//      result = (Lazy(result) * value) % modulus;   // one fused multiply-mod
+//      t1 = Lazy(q) * v1 + u1;                      // one fused multiply-add
+//      x = (Lazy(y) << 32) + z;                     // one fused shift-add
+//
+//  Expression is evaluated on assignment (or on conversion to IntX) right into
+//  destination object. It only keeps references to its operands, so it must be
+//  evaluated in the same full expression it was built in.
+//==================================================================
+
+/// <summary>
+/// Base class of all lazy expressions over <see cref="IntX" />.
+/// </summary>
+/// <typeparam name="TExpr">Actual expression type (must have EvaluateTo(IntX &amp;) method).</typeparam>
+template <typename TExpr>
+class IntXExpression
+{
+public:
+	// Returns actual expression object.
+	const TExpr &Self() const
+	{
+		return static_cast<const TExpr &>(*this);
+	} // end function Self
+
+	// Evaluates expression into new big integer.
+	IntX Evaluate() const
+	{
+		IntX result;
+		Self().EvaluateTo(result);
+		return result;
+	} // end function Evaluate
+
+}; // end class IntXExpression
+
+/// <summary>
+/// Big integer operand marked for lazy evaluation (see <see cref="Lazy" />).
+/// </summary>
+class LazyIntX
+{
+public:
+	explicit LazyIntX(const IntX &value) : Value(value)
+	{
+		// Empty
+	} // end constructor
+
+	const IntX &Value; // wrapped big integer
+
+}; // end class LazyIntX
+
+/// <summary>
+/// Product of two big integers.
+/// </summary>
+class MultiplyExpr : public IntXExpression<MultiplyExpr>
+{
+public:
+	MultiplyExpr(const IntX &int1, const IntX &int2) : Int1(int1), Int2(int2)
+	{
+		// Empty
+	} // end constructor
+
+	void EvaluateTo(IntX &result) const
+	{
+		IntX::MultiplyAdd(result, Int1, Int2, IntX(), false, false);
+	} // end function EvaluateTo
+
+	const IntX &Int1; // first multiplier
+	const IntX &Int2; // second multiplier
+
+}; // end class MultiplyExpr
+
+/// <summary>
+/// Product plus (or minus) big integer. Calculated by <see cref="IntX::MultiplyAdd" />.
+/// </summary>
+class MultiplyAddExpr : public IntXExpression<MultiplyAddExpr>
+{
+public:
+	MultiplyAddExpr(const MultiplyExpr &product, const IntX &int3, const bool negateProduct, const bool subtract)
+		: Product(product), Int3(int3), NegateProduct(negateProduct), Subtract(subtract)
+	{
+		// Empty
+	} // end constructor
+
+	void EvaluateTo(IntX &result) const
+	{
+		IntX::MultiplyAdd(result, Product.Int1, Product.Int2, Int3, NegateProduct, Subtract);
+	} // end function EvaluateTo
+
+	MultiplyExpr Product; // product
+	const IntX &Int3; // addend
+	bool NegateProduct; // product is subtracted
+	bool Subtract; // addend is subtracted
+
+}; // end class MultiplyAddExpr
+
+/// <summary>
+/// Product modulo big integer. Calculated by <see cref="IntX::MultiplyModulo" />.
+/// </summary>
+class MultiplyModuloExpr : public IntXExpression<MultiplyModuloExpr>
+{
+public:
+	MultiplyModuloExpr(const MultiplyExpr &product, const IntX &modulus) : Product(product), Modulus(modulus)
+	{
+		// Empty
+	} // end constructor
+
+	void EvaluateTo(IntX &result) const
+	{
+		IntX::MultiplyModulo(result, Product.Int1, Product.Int2, Modulus);
+	} // end function EvaluateTo
+
+	MultiplyExpr Product; // product
+	const IntX &Modulus; // modulus
+
+}; // end class MultiplyModuloExpr
+
+/// <summary>
+/// Big integer shifted to the left (negative shift means right shift).
+/// </summary>
+class ShiftExpr : public IntXExpression<ShiftExpr>
+{
+public:
+	ShiftExpr(const IntX &int1, const long long shift) : Int1(int1), Shift(shift)
+	{
+		// Empty
+	} // end constructor
+
+	void EvaluateTo(IntX &result) const
+	{
+		IntX::ShiftAdd(result, Int1, Shift, IntX(), false, false);
+	} // end function EvaluateTo
+
+	const IntX &Int1; // big integer to shift
+	long long Shift; // bits count
+
+}; // end class ShiftExpr
+
+/// <summary>
+/// Shifted big integer plus (or minus) big integer. Calculated by <see cref="IntX::ShiftAdd" />.
+/// </summary>
+class ShiftAddExpr : public IntXExpression<ShiftAddExpr>
+{
+public:
+	ShiftAddExpr(const ShiftExpr &shifted, const IntX &int3, const bool negateShifted, const bool subtract)
+		: Shifted(shifted), Int3(int3), NegateShifted(negateShifted), Subtract(subtract)
+	{
+		// Empty
+	} // end constructor
+
+	void EvaluateTo(IntX &result) const
+	{
+		IntX::ShiftAdd(result, Shifted.Int1, Shifted.Shift, Int3, NegateShifted, Subtract);
+	} // end function EvaluateTo
+
+	ShiftExpr Shifted; // shifted value
+	const IntX &Int3; // addend
+	bool NegateShifted; // shifted value is subtracted
+	bool Subtract; // addend is subtracted
+
+}; // end class ShiftAddExpr
+
+//==================================================================
+//  Expression building
+//==================================================================
+
+/// <summary>
+/// Marks big integer for lazy evaluation of expression it takes part in.
+/// </summary>
+/// <param name="value">Big integer.</param>
+/// <returns>Lazy operand.</returns>
+inline LazyIntX Lazy(const IntX &value)
+{
+	return LazyIntX(value);
+} // end function Lazy
+
+inline MultiplyExpr operator*(const LazyIntX &int1, const IntX &int2)
+{
+	return MultiplyExpr(int1.Value, int2);
+} // end operator *
+
+inline MultiplyExpr operator*(const IntX &int1, const LazyIntX &int2)
+{
+	return MultiplyExpr(int1, int2.Value);
+} // end operator *
+
+inline MultiplyExpr operator*(const LazyIntX &int1, const LazyIntX &int2)
+{
+	return MultiplyExpr(int1.Value, int2.Value);
+} // end operator *
+
+inline MultiplyAddExpr operator+(const MultiplyExpr &product, const IntX &int3)
+{
+	return MultiplyAddExpr(product, int3, false, false);
+} // end operator +
+
+inline MultiplyAddExpr operator+(const IntX &int3, const MultiplyExpr &product)
+{
+	return MultiplyAddExpr(product, int3, false, false);
+} // end operator +
+
+inline MultiplyAddExpr operator-(const MultiplyExpr &product, const IntX &int3)
+{
+	return MultiplyAddExpr(product, int3, false, true);
+} // end operator -
+
+inline MultiplyAddExpr operator-(const IntX &int3, const MultiplyExpr &product)
+{
+	return MultiplyAddExpr(product, int3, true, false);
+} // end operator -
+
+inline MultiplyModuloExpr operator%(const MultiplyExpr &product, const IntX &modulus)
+{
+	return MultiplyModuloExpr(product, modulus);
+} // end operator %
+
+inline ShiftExpr operator<<(const LazyIntX &int1, const long long shift)
+{
+	return ShiftExpr(int1.Value, shift);
+} // end operator <<
+
+inline ShiftExpr operator>>(const LazyIntX &int1, const long long shift)
+{
+	return ShiftExpr(int1.Value, -shift);
+} // end operator >>
+
+inline ShiftAddExpr operator+(const ShiftExpr &shifted, const IntX &int3)
+{
+	return ShiftAddExpr(shifted, int3, false, false);
+} // end operator +
+
+inline ShiftAddExpr operator+(const IntX &int3, const ShiftExpr &shifted)
+{
+	return ShiftAddExpr(shifted, int3, false, false);
+} // end operator +
+
+inline ShiftAddExpr operator-(const ShiftExpr &shifted, const IntX &int3)
+{
+	return ShiftAddExpr(shifted, int3, false, true);
+} // end operator -
+
+inline ShiftAddExpr operator-(const IntX &int3, const ShiftExpr &shifted)
+{
+	return ShiftAddExpr(shifted, int3, true, false);
+} // end operator -
+
+#endif // !INTXEXPRESSION_H
@@ -0,0 +1,194 @@
+#pragma once
+
+#ifndef INTXVIEW_H
+#define INTXVIEW_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "IntX.h"
+#include "OpHelpers/DigitHelper.h"
+
+using namespace std;
+
+//==================================================================
+//  Read-only big integer over digits owned by someone else (opt-in).
+//
+//      IntXView view(buffer + offset, count, false);    // no digits are copied
+//      IntX product = view * IntX::Pow(3, 100);
+//      string text = view.ToString(16);
+//
+//  View converts to const IntX &, so it is accepted by every read-only operation
+//  (comparison, arithmetic operators, IntX::Multiply, IntX::Divide, ...). Viewed digits
+//  must outlive the view and must not change while it is used. Copying view into IntX
+//  makes an owning copy of digits.
+//==================================================================
+
+/// <summary>
+/// Non-owning read-only big integer: pointer to digits, length and sign.
+/// </summary>
+class IntXView
+{
+public:
+	//==================================================================
+	//  Constructors
+	//==================================================================
+
+	/// <summary>
+	/// Creates view over digits array. Digit with lower index has less weight.
+	/// </summary>
+	/// <param name="digits">Digits array (at least 4-byte aligned).</param>
+	/// <param name="length">Digits count (leading zero digits are not counted).</param>
+	/// <param name="negative">True if number is negative.</param>
+	/// <exception cref="ArgumentNullException"><paramref name="digits" /> is a null reference.</exception>
+	IntXView(const UInt32 *digits, const UInt32 length, const bool negative)
+	{
+		// Exceptions
+		if (digits == nullptr && length != 0)
+		{
+			throw ArgumentNullException("digits");
+		} // end if
+
+		Init(digits, DigitHelper::GetRealDigitsLength(digits, length), negative);
+	} // end constructor
+
+	/// <summary>
+	/// Creates view over digits of existing big integer.
+	/// </summary>
+	/// <param name="value">Big integer (must not change while view is used).</param>
+	IntXView(const IntX &value)
+	{
+		Init(value.digits.data(), value.length, value.negative);
+	} // end constructor
+
+	IntXView(const IntXView &view)
+	{
+		Init(view.getDigits(), view.getLength(), view.IsNegative());
+	} // end copy constructor
+
+	IntXView &operator=(const IntXView &view)
+	{
+		Init(view.getDigits(), view.getLength(), view.IsNegative());
+		return *this;
+	} // end function operator=
+
+	//==================================================================
+	//  Properties
+	//==================================================================
+
+	// Returns pointer to viewed digits.
+	const UInt32 *getDigits() const
+	{
+		return value.digits.data();
+	} // end function getDigits
+
+	// Returns digits count.
+	UInt32 getLength() const
+	{
+		return value.length;
+	} // end function getLength
+
+	// Returns true if number is negative.
+	bool IsNegative() const
+	{
+		return value.negative;
+	} // end function IsNegative
+
+	// Returns viewed number as big integer (it refers to the same digits).
+	const IntX &Value() const
+	{
+		return value;
+	} // end function Value
+
+	operator const IntX &() const
+	{
+		return value;
+	} // end operator const IntX &
+
+	//==================================================================
+	//  ToString
+	//==================================================================
+
+	string ToString() const
+	{
+		return value.ToString();
+	} // end function ToString
+
+	string ToString(const UInt32 numberBase) const
+	{
+		return value.ToString(numberBase);
+	} // end function ToString
+
+	string ToString(const UInt32 numberBase, const bool upperCase) const
+	{
+		return value.ToString(numberBase, upperCase);
+	} // end function ToString
+
+private:
+	// Points big integer to viewed digits.
+	void Init(const UInt32 *digits, const UInt32 length, const bool negative)
+	{
+		value.digits.Borrow(digits, length);
+		value.length = length;
+		value.negative = length != 0 && negative;
+	} // end function Init
+
+	IntX value; // big integer borrowing viewed digits
+
+}; // end class IntXView
+
+//==================================================================
+//  Operators with view operands (they avoid implicit copying of viewed digits)
+//==================================================================
+
+inline bool operator==(const IntXView &int1, const IntXView &int2) { return int1.Value() == int2.Value(); }
+inline bool operator==(const IntXView &int1, const IntX &int2) { return int1.Value() == int2; }
+inline bool operator==(const IntX &int1, const IntXView &int2) { return int1 == int2.Value(); }
+
+inline bool operator!=(const IntXView &int1, const IntXView &int2) { return int1.Value() != int2.Value(); }
+inline bool operator!=(const IntXView &int1, const IntX &int2) { return int1.Value() != int2; }
+inline bool operator!=(const IntX &int1, const IntXView &int2) { return int1 != int2.Value(); }
+
+inline bool operator>(const IntXView &int1, const IntXView &int2) { return int1.Value() > int2.Value(); }
+inline bool operator>(const IntXView &int1, const IntX &int2) { return int1.Value() > int2; }
+inline bool operator>(const IntX &int1, const IntXView &int2) { return int1 > int2.Value(); }
+
+inline bool operator>=(const IntXView &int1, const IntXView &int2) { return int1.Value() >= int2.Value(); }
+inline bool operator>=(const IntXView &int1, const IntX &int2) { return int1.Value() >= int2; }
+inline bool operator>=(const IntX &int1, const IntXView &int2) { return int1 >= int2.Value(); }
+
+inline bool operator<(const IntXView &int1, const IntXView &int2) { return int1.Value() < int2.Value(); }
+inline bool operator<(const IntXView &int1, const IntX &int2) { return int1.Value() < int2; }
+inline bool operator<(const IntX &int1, const IntXView &int2) { return int1 < int2.Value(); }
+
+inline bool operator<=(const IntXView &int1, const IntXView &int2) { return int1.Value() <= int2.Value(); }
+inline bool operator<=(const IntXView &int1, const IntX &int2) { return int1.Value() <= int2; }
+inline bool operator<=(const IntX &int1, const IntXView &int2) { return int1 <= int2.Value(); }
+
+inline IntX operator+(const IntXView &int1, const IntXView &int2) { return int1.Value() + int2.Value(); }
+inline IntX operator+(const IntXView &int1, const IntX &int2) { return int1.Value() + int2; }
+inline IntX operator+(const IntX &int1, const IntXView &int2) { return int1 + int2.Value(); }
+
+inline IntX operator-(const IntXView &int1, const IntXView &int2) { return int1.Value() - int2.Value(); }
+inline IntX operator-(const IntXView &int1, const IntX &int2) { return int1.Value() - int2; }
+inline IntX operator-(const IntX &int1, const IntXView &int2) { return int1 - int2.Value(); }
+
+inline IntX operator*(const IntXView &int1, const IntXView &int2) { return int1.Value() * int2.Value(); }
+inline IntX operator*(const IntXView &int1, const IntX &int2) { return int1.Value() * int2; }
+inline IntX operator*(const IntX &int1, const IntXView &int2) { return int1 * int2.Value(); }
+
+inline IntX operator/(const IntXView &int1, const IntXView &int2) { return int1.Value() / int2.Value(); }
+inline IntX operator/(const IntXView &int1, const IntX &int2) { return int1.Value() / int2; }
+inline IntX operator/(const IntX &int1, const IntXView &int2) { return int1 / int2.Value(); }
+
+inline IntX operator%(const IntXView &int1, const IntXView &int2) { return int1.Value() % int2.Value(); }
+inline IntX operator%(const IntXView &int1, const IntX &int2) { return int1.Value() % int2; }
+inline IntX operator%(const IntX &int1, const IntXView &int2) { return int1 % int2.Value(); }
+
+inline ostream &operator<<(ostream &stream, const IntXView &view)
+{
+	return stream << view.Value();
+} // end operator <<
+
+#endif // !INTXVIEW_H
@@ -14,6 +14,7 @@ typedef unsigned int UInt32;
 #include "../OpHelpers/DigitOpHelper.h"
 
 #include <algorithm>
+#include <atomic>
 #include <vector>
 
 using namespace std;
@@ -26,12 +27,24 @@ public:
 	/// <summary>
 	/// Creates new <see cref="AutoFhtMultiplier" /> instance.
 	/// </summary>
-	/// <param name="classicMultiplier">Multiplier to use if FHT is unapplicatible.</param>
-	AutoFhtMultiplier(IMultiplier &classicMultiplier)
+	/// <param name="lowerMultiplier">Multiplier to use if FHT is unapplicatible (Toom-Cook, Karatsuba or classic one).</param>
+	/// <param name="upperMultiplier">Multiplier to use if FHT precision isn't enough (NTT one).</param>
+	AutoFhtMultiplier(IMultiplier &lowerMultiplier, IMultiplier &upperMultiplier)
 	{
-		_classicMultiplier = &classicMultiplier;
+		_lowerMultiplier = &lowerMultiplier;
+		_upperMultiplier = &upperMultiplier;
+		_fallbackCount = 0;
 	} // end .cctr
 
+	/// <summary>
+	/// Returns count of FHT results which were rejected by validity check (and so computed again by upper multiplier).
+	/// </summary>
+	/// <returns>Count of rejected results.</returns>
+	UInt32 getFallbackCount() const
+	{
+		return _fallbackCount;
+	} // end function getFallbackCount
+
 	/// <summary>
 	/// Multiplies two big integers using pointers.
 	/// </summary>
@@ -43,75 +56,493 @@ public:
 	/// <returns>Resulting big integer real length.</returns>
 	virtual UInt32 Multiply(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2,const UInt32 length2, UInt32 *digitsResPtr)
 	{
-		//unsigned int* digitsPtr1 = &vdigitsPtr1[0], *digitsPtr2 = &vdigitsPtr2[0], *digitsResPtr = &vdigitsResPtr[0];
+		// The same digits are squared
+		if (digitsPtr1 == digitsPtr2 && length1 == length2)
+		{
+			return Sqr(digitsPtr1, length1, digitsResPtr);
+		} // end if
 
-		// Check length - maybe use classic multiplier instead
-		if (length1 < Constants::AutoFhtLengthLowerBound || length2 < Constants::AutoFhtLengthLowerBound ||
-			length1 > Constants::AutoFhtLengthUpperBound || length2 > Constants::AutoFhtLengthUpperBound)
+		// First must be bigger
+		if (length1 < length2)
 		{
-			return _classicMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+			return Multiply(digitsPtr2, length2, digitsPtr1, length1, digitsResPtr);
+		} // end if
+
+		// Check length - maybe use lower multiplier instead
+		if (length1 < Constants::AutoFhtLengthLowerBound || length2 < Constants::AutoFhtUnbalancedLengthLowerBound ||
+			(length2 < Constants::AutoFhtLengthLowerBound && length1 / length2 < Constants::AutoFhtUnbalancedRatio))
+		{
+			return _lowerMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
 		} // end if
 
 		UInt32 newLength = length1 + length2;
 
-		// Do FHT for first big integer
-		vector<double> data1 = FhtHelper::ConvertDigitsToDouble(digitsPtr1, length1, newLength);
-		FhtHelper::Fht(&data1[0], data1.size());
+		// Much longer big integer is multiplied by blocks
+		UInt32 blockLength = GetBlockLength(length1, length2);
+		if (blockLength != 0)
+		{
+			double roundingError = MultiplyByBlocks(digitsPtr1, length1, digitsPtr2, length2, blockLength, digitsResPtr);
+			if (!IsValid(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr, roundingError))
+			{
+				++_fallbackCount;
+				return _upperMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+			} // end if
+			return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+		} // end if
 
-		// Compare digits
-		vector<double> data2;
-		if (digitsPtr1 == digitsPtr2 || DigitOpHelper::Cmp(digitsPtr1, length1, digitsPtr2, length2) == 0)
+		// FHT isn't precise enough for such lengths - use exact upper multiplier instead
+		if (length1 > Constants::AutoFhtLengthUpperBound)
 		{
-			// Use the same FHT for equal big integers
-			data2 = vector<double>(data1);
+			return _upperMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
 		} // end if
-		else
+
+		// Result which is just a bit longer than half of transform can hold is got by cyclic multiplication
+		UInt32 cyclicLength = GetCyclicLength(length1, length2);
+		if (cyclicLength != 0)
 		{
-			// Do FHT over second digits
-			data2 = FhtHelper::ConvertDigitsToDouble((UInt32 *)digitsPtr2, length2, newLength);
-			FhtHelper::Fht(&data2[0], data2.size());
-		} // end else
+			double roundingError = MultiplyCyclic(digitsPtr1, length1, digitsPtr2, length2, cyclicLength, digitsResPtr);
+			if (!IsValid(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr, roundingError))
+			{
+				++_fallbackCount;
+				return _upperMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+			} // end if
+			return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+		} // end if
+
+		// Do FHT for first big integer
+		int bits = FhtHelper::GetDoubleDataBits(newLength);
+		PooledArray<double> data1(FhtHelper::GetDoubleDataLength(newLength), false);
+		FhtHelper::ConvertDigitsToFht(digitsPtr1, length1, data1.data(), data1.size(), bits, GetFhtThreadCount(), nullptr);
 
-		// Perform multiplication and reverse FHT
-		FhtHelper::MultiplyFhtResults(&data1[0], &data2[0], data1.size());
-		FhtHelper::ReverseFht(&data1[0], data1.size());
+		// Do FHT over second digits (it's multiplied by the first one at once)
+		PooledArray<double> data2(data1.size(), false);
+		MultiplyAndReverse(digitsPtr2, length2, data2, bits, data1.data());
 
 		// Convert to digits
-		double* slice1 = &data1[0];
-		FhtHelper::ConvertDoubleToDigits(slice1, data1.size(), newLength, digitsResPtr);
+		double roundingError = FhtHelper::ConvertDoubleToDigits(data2.data(), data2.size(), newLength, digitsResPtr, bits);
 
+		// Check for validity - exact upper multiplier is used if FHT wasn't precise enough
+		if (!IsValid(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr, roundingError))
+		{
+			++_fallbackCount;
+			return _upperMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+		} // end if
+
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function Multiply
 
-		// Maybe check for validity using classic multiplication
-		if (IntX::getGlobalSettings()->getApplyFhtValidityCheck())
+	/// <summary>
+	/// Squares big integer using pointers (only one FHT is done).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use lower or upper multiplier instead
+		if (length < Constants::AutoFhtLengthLowerBound)
 		{
-			UInt32 lowerDigitCount = min(length2, min(length1, Constants::FhtValidityCheckDigitCount));
+			return _lowerMultiplier->Sqr(digitsPtr, length, digitsResPtr);
+		} // end if
+		if (length > Constants::AutoFhtLengthUpperBound)
+		{
+			return _upperMultiplier->Sqr(digitsPtr, length, digitsResPtr);
+		} // end if
+
+		UInt32 newLength = 2 * length;
 
-			// Validate result by multiplying lowerDigitCount digits using classic algorithm and comparing
-			vector<UInt32> validationResult(lowerDigitCount * 2);
-			UInt32* validationResultPtr = &validationResult[0];
-			
-			_classicMultiplier->Multiply(digitsPtr1, lowerDigitCount, digitsPtr2, lowerDigitCount, &validationResult[0]);
-			if (DigitOpHelper::Cmp(validationResultPtr, lowerDigitCount, digitsResPtr, lowerDigitCount) != 0)
+		// Result which is just a bit longer than half of transform can hold is got by cyclic squaring
+		UInt32 cyclicLength = GetCyclicLength(length, length);
+		if (cyclicLength != 0)
+		{
+			double roundingError = MultiplyCyclic(digitsPtr, length, digitsPtr, length, cyclicLength, digitsResPtr);
+			if (!IsValid(digitsPtr, length, digitsPtr, length, digitsResPtr, roundingError))
 			{
-				throw FhtMultiplicationException(string(Strings::FhtMultiplicationError));
+				++_fallbackCount;
+				return _upperMultiplier->Sqr(digitsPtr, length, digitsResPtr);
 			} // end if
+			return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+		} // end if
+
+		// FHT result is multiplied by itself
+		int bits = FhtHelper::GetDoubleDataBits(newLength);
+		PooledArray<double> data(FhtHelper::GetDoubleDataLength(newLength), false);
+		MultiplyAndReverse(digitsPtr, length, data, bits, data.data());
+
+		// Convert to digits
+		double roundingError = FhtHelper::ConvertDoubleToDigits(data.data(), data.size(), newLength, digitsResPtr, bits);
+
+		// Check for validity - exact upper multiplier is used if FHT wasn't precise enough
+		if (!IsValid(digitsPtr, length, digitsPtr, length, digitsResPtr, roundingError))
+		{
+			++_fallbackCount;
+			return _upperMultiplier->Sqr(digitsPtr, length, digitsResPtr);
 		} // end if
-		
-		//try
-		//{
-		//	digitsResPtr[newLength - 1];
-		//} // end try
-		//catch (const std::exception&e)
-		//{
-		//	--newLength;
-		//} // end catch
-		//UInt32 d = digitsResPtr[newLength - 2];
+
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function Sqr
+
+	/// <summary>
+	/// Prepares big integer for repeated multiplication: its FHT is done once (if FHT would be used for it).
+	/// </summary>
+	/// <param name="operand">Big integer to prepare.</param>
+	virtual void Prepare(PreparedOperand &operand)
+	{
+		if (!CanUsePreparedSpectrum(operand.length, operand.otherLengthMax)) return;
+
+		UInt32 newLength = operand.length + operand.otherLengthMax;
+		PooledArray<double> spectrum(FhtHelper::GetDoubleDataLength(newLength), false);
+		FhtHelper::ConvertDigitsToFht(operand.digitsPtr, operand.length, spectrum.data(), spectrum.size(),
+			FhtHelper::GetDoubleDataBits(newLength), GetFhtThreadCount(), nullptr);
+		operand.spectrum.swap(spectrum);
+	} // end function Prepare
+
+	/// <summary>
+	/// Multiplies prepared big integer by other one using pointers (only one FHT and one reverse FHT are done).
+	/// </summary>
+	/// <param name="operand">Prepared big integer.</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Multiply(const PreparedOperand &operand, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		UInt32 newLength = operand.length + length2;
+
+		// Prepared FHT may be not suitable for this length (bigger transform isn't cheaper than usual multiplication);
+		// digits of prepared one are packed for the longest result, so shorter ones fit into such packing too
+		int bits = FhtHelper::GetDoubleDataBits(operand.length + operand.otherLengthMax);
+		if (operand.spectrum.size() != FhtHelper::GetDoubleDataLength(newLength) || FhtHelper::GetDoubleDataBits(newLength) > bits ||
+			!CanUsePreparedSpectrum(operand.length, length2))
+		{
+			return Multiply(operand.digitsPtr, operand.length, digitsPtr2, length2, digitsResPtr);
+		} // end if
+
+		// Do FHT over second digits (it's multiplied by prepared one at once)
+		PooledArray<double> data2(operand.spectrum.size(), false);
+		MultiplyAndReverse(digitsPtr2, length2, data2, bits, operand.spectrum.data());
+
+		// Convert to digits
+		double roundingError = FhtHelper::ConvertDoubleToDigits(data2.data(), data2.size(), newLength, digitsResPtr, bits);
+
+		// Check for validity - exact upper multiplier is used if FHT wasn't precise enough
+		if (!IsValid(operand.digitsPtr, operand.length, digitsPtr2, length2, digitsResPtr, roundingError))
+		{
+			++_fallbackCount;
+			return _upperMultiplier->Multiply(operand.digitsPtr, operand.length, digitsPtr2, length2, digitsResPtr);
+		} // end if
+
 		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
-		//return newLength;
 	} // end function Multiply
 
+protected:
+
+	/// <summary>
+	/// Checks FHT result validity: rounding error of real digits must be small enough and (if it's set in global
+	/// settings) residues of the whole result modulo 2^64 - 1 and <see cref="Constants::FhtCheckPrime" /> must be
+	/// equal to the products of big integers residues.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits (of <paramref name="length1" /> + <paramref name="length2" /> length).</param>
+	/// <param name="roundingError">Maximal rounding error (see <see cref="FhtHelper::ConvertDoubleToDigits" />).</param>
+	/// <returns>True if result is valid.</returns>
+	virtual bool IsValid(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		const UInt32 *digitsResPtr, const double roundingError) const
+	{
+		if (roundingError > FhtHelper::MaxRoundingError) return false;
+		if (!IntX::getGlobalSettings()->getApplyFhtValidityCheck()) return true;
+
+		UInt64 residue1, residue2, residueRes;
+		UInt32 primeResidue1, primeResidue2, primeResidueRes;
+		GetResidues(digitsPtr1, length1, residue1, primeResidue1);
+		if (digitsPtr1 == digitsPtr2 && length1 == length2)
+		{
+			residue2 = residue1;
+			primeResidue2 = primeResidue1;
+		} // end if
+		else
+		{
+			GetResidues(digitsPtr2, length2, residue2, primeResidue2);
+		} // end else
+		GetResidues(digitsResPtr, length1 + length2, residueRes, primeResidueRes);
+
+		// 2^64 - 1 is the same residue as 0
+		UInt64 residueProduct = MultiplyModulo64(residue1, residue2);
+		return (residueRes == ~0ULL ? 0 : residueRes) == (residueProduct == ~0ULL ? 0 : residueProduct) &&
+			primeResidueRes == (UInt32)((UInt64)primeResidue1 * primeResidue2 % Constants::FhtCheckPrime);
+	} // end function IsValid
+
 private:
-	IMultiplier *_classicMultiplier;
+	IMultiplier *_lowerMultiplier;
+	IMultiplier *_upperMultiplier;
+	atomic<UInt32> _fallbackCount; // count of results rejected by IsValid
+
+	/// <summary>
+	/// Returns maximal count of threads used by FHT (from global settings).
+	/// </summary>
+	static UInt32 GetFhtThreadCount()
+	{
+		return IntX::getGlobalSettings()->getFhtThreadCount();
+	} // end function GetFhtThreadCount
+
+	/// <summary>
+	/// Performs FHT of big integer, multiplies it by other FHT result and performs reverse FHT
+	/// (see <see cref="FhtHelper::ConvertDigitsToFht" />).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="data">Double array (it may be dirty), gets multiplication result.</param>
+	/// <param name="bits">Count of bits per double.</param>
+	/// <param name="data2">Other FHT result (the same as <paramref name="data" /> for squaring).</param>
+	static void MultiplyAndReverse(const UInt32 *digitsPtr, const UInt32 length, PooledArray<double> &data, const int bits,
+		const double *data2)
+	{
+		FhtHelper::ConvertDigitsToFht(digitsPtr, length, data.data(), data.size(), bits, GetFhtThreadCount(), data2);
+		FhtHelper::ParallelReverseFht(data.data(), data.size(), GetFhtThreadCount());
+	} // end function MultiplyAndReverse
+
+	/// <summary>
+	/// Checks if usual FHT multiplication (with transforms of the whole result length) is used for given lengths,
+	/// so that prepared FHT of one big integer can be used instead of its transform.
+	/// </summary>
+	static bool CanUsePreparedSpectrum(const UInt32 length1, const UInt32 length2)
+	{
+		UInt32 lengthMax = length1 < length2 ? length2 : length1, lengthMin = length1 < length2 ? length1 : length2;
+		return lengthMin >= Constants::AutoFhtLengthLowerBound && lengthMax <= Constants::AutoFhtLengthUpperBound &&
+			GetBlockLength(lengthMax, lengthMin) == 0;
+	} // end function CanUsePreparedSpectrum
+
+	/// <summary>
+	/// Returns length of the blocks longer big integer should be cut into, so that FHT of the shorter one is done
+	/// only once and reused for all of them. Total amount of FHT work is estimated (n * log(n) for each transform).
+	/// </summary>
+	/// <param name="length1">Longer big integer length.</param>
+	/// <param name="length2">Shorter big integer length.</param>
+	/// <returns>Block length (0 if usual multiplication is cheaper).</returns>
+	static UInt32 GetBlockLength(const UInt32 length1, const UInt32 length2)
+	{
+		UInt32 blockLength = 0;
+
+		// Usual multiplication: three transforms of the whole result length (if FHT is precise enough for it)
+		UInt32 transformLength = FhtHelper::GetDoubleDataLength(length1 + length2);
+		double cost = length1 > Constants::AutoFhtLengthUpperBound ? HUGE_VAL : 3.0 * transformLength * Bits::Msb(transformLength);
+
+		// Block multiplication: transform of the shorter big integer and two transforms for each block
+		for (UInt32 blockTransformLength = 1U << Bits::CeilLog2(2 * length2);
+			blockTransformLength < length1 + length2 && blockTransformLength <= 2 * Constants::AutoFhtLengthUpperBound;
+			blockTransformLength <<= 1)
+		{
+			UInt32 nextBlockLength = blockTransformLength - length2;
+			UInt32 blockCount = (length1 + nextBlockLength - 1) / nextBlockLength;
+			transformLength = FhtHelper::GetDoubleDataLength(blockTransformLength);
+			double blockCost = (1.0 + 2.0 * blockCount) * transformLength * Bits::Msb(transformLength);
+			if (blockCost < cost)
+			{
+				cost = blockCost;
+				blockLength = nextBlockLength;
+			} // end if
+		} // end for
+
+		return blockLength;
+	} // end function GetBlockLength
+
+	/// <summary>
+	/// Returns length of cyclic multiplication result (see <see cref="FhtHelper::GetCyclicDigitsLength" />) if it's
+	/// cheaper than usual one: its transforms are twice shorter, but lower digits of the result must be also got
+	/// by usual multiplication of lower digits (see <see cref="MultiplyCyclic" />). It's cheaper if transforms
+	/// of that multiplication are shorter too (so three of them are still cheaper than the saved ones).
+	/// </summary>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <returns>Cyclic length (0 if usual multiplication is cheaper).</returns>
+	static UInt32 GetCyclicLength(const UInt32 length1, const UInt32 length2)
+	{
+		UInt32 newLength = length1 + length2, dataLength;
+		int bits;
+		UInt32 cyclicLength = FhtHelper::GetCyclicDigitsLength(newLength, dataLength, bits);
+
+		// Each big integer must fit into cyclic length, and its bits - into whole digits
+		UInt32 lowLength = newLength - cyclicLength + 1;
+		if (length1 > cyclicLength || length2 > cyclicLength || lowLength > cyclicLength / 2 || (dataLength & 31) != 0)
+		{
+			return 0;
+		} // end if
+
+		return FhtHelper::GetDoubleDataLength(2 * lowLength) <= dataLength / 2 ? cyclicLength : 0;
+	} // end function GetCyclicLength
+
+	/// <summary>
+	/// Multiplies big integers using cyclic FHT multiplication: result modulo 2^(32 * cyclicLength) - 1 is the sum
+	/// of its lower and upper digits. Lower digits of the result (one more than upper ones) are got by usual
+	/// multiplication of lower digits, and then both parts are restored from that sum.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="digitsPtr2">Second big integer digits (may be the same as the first ones).</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="cyclicLength">Cyclic length (see <see cref="GetCyclicLength" />).</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Maximal rounding error (see <see cref="FhtHelper::ConvertDoubleToDigits" />).</returns>
+	double MultiplyCyclic(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		const UInt32 cyclicLength, UInt32 *digitsResPtr)
+	{
+		UInt32 newLength = length1 + length2, dataLength, i;
+		int bits;
+		FhtHelper::GetCyclicDigitsLength(newLength, dataLength, bits);
+
+		// Do FHT for both big integers (only once if they are the same)
+		PooledArray<double> data1(dataLength, false);
+		if (digitsPtr1 == digitsPtr2 && length1 == length2)
+		{
+			MultiplyAndReverse(digitsPtr1, length1, data1, bits, data1.data());
+		} // end if
+		else
+		{
+			PooledArray<double> data2(dataLength, false);
+			FhtHelper::ConvertDigitsToFht(digitsPtr2, length2, data2.data(), dataLength, bits, GetFhtThreadCount(), nullptr);
+			MultiplyAndReverse(digitsPtr1, length1, data1, bits, data2.data());
+		} // end else
+
+		// Convert to digits (2^(32 * cyclicLength) - 1 is the same as 0 here)
+		double roundingError = FhtHelper::ConvertDoubleToDigits(data1.data(), dataLength, cyclicLength, digitsResPtr, bits);
+		for (i = 0; i < cyclicLength && digitsResPtr[i] == 0xFFFFFFFFU; ++i);
+		if (i == cyclicLength)
+		{
+			DigitHelper::SetBlockDigits(digitsResPtr, cyclicLength, 0U);
+		} // end if
+
+		// Multiply lower digits
+		UInt32 upperLength = newLength - cyclicLength, lowLength = upperLength + 1;
+		UInt32 lowLength1 = DigitHelper::GetRealDigitsLength(digitsPtr1, min(length1, lowLength));
+		UInt32 lowLength2 = DigitHelper::GetRealDigitsLength(digitsPtr2, min(length2, lowLength));
+		PooledArray<UInt32> lowProduct(2 * lowLength, false);
+		DigitHelper::SetBlockDigits(lowProduct.data(), 2 * lowLength, 0U);
+		if (lowLength1 != 0 && lowLength2 != 0)
+		{
+			Multiply(digitsPtr1, lowLength1, digitsPtr2, lowLength2, lowProduct.data());
+		} // end if
+
+		// Upper digits are (sum - lower ones) modulo 2^(32 * lowLength) (they are less than 2^(32 * upperLength))
+		PooledArray<UInt32> upper(lowLength, false);
+		UInt64 c = 0;
+		for (i = 0; i < lowLength; ++i)
+		{
+			c = (UInt64)digitsResPtr[i] - lowProduct[i] - c;
+			upper[i] = (UInt32)c;
+			c >>= 63;
+		} // end for
+
+		// Lower digits are sum - upper ones; if it's negative, sum was 2^(32 * cyclicLength) - 1 less
+		// (so upper digits are 1 less too)
+		c = 0;
+		for (i = 0; i < lowLength; ++i)
+		{
+			c = (UInt64)digitsResPtr[i] - upper[i] - c;
+			digitsResPtr[i] = (UInt32)c;
+			c >>= 63;
+		} // end for
+		for (; c != 0 && i < cyclicLength; ++i)
+		{
+			c = (UInt64)digitsResPtr[i] - c;
+			digitsResPtr[i] = (UInt32)c;
+			c >>= 63;
+		} // end for
+		for (i = 0; c != 0 && i < upperLength; ++i)
+		{
+			c = (UInt64)upper[i] - c;
+			upper[i] = (UInt32)c;
+			c >>= 63;
+		} // end for
+
+		DigitHelper::DigitsBlockCopy(upper.data(), digitsResPtr + cyclicLength, upperLength);
+		return roundingError;
+	} // end function MultiplyCyclic
+
+	/// <summary>
+	/// Multiplies long big integer by a much shorter one: longer one is cut into blocks and their products
+	/// are accumulated. FHT of the shorter big integer is done only once.
+	/// </summary>
+	/// <param name="digitsPtr1">Longer big integer digits.</param>
+	/// <param name="length1">Longer big integer length.</param>
+	/// <param name="digitsPtr2">Shorter big integer digits.</param>
+	/// <param name="length2">Shorter big integer length.</param>
+	/// <param name="blockLength">Block length (see <see cref="GetBlockLength" />).</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Maximal rounding error of block products (see <see cref="FhtHelper::ConvertDoubleToDigits" />).</returns>
+	static double MultiplyByBlocks(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		const UInt32 blockLength, UInt32 *digitsResPtr)
+	{
+		int bits = FhtHelper::GetDoubleDataBits(blockLength + length2);
+		PooledArray<double> data2(FhtHelper::GetDoubleDataLength(blockLength + length2), false);
+		FhtHelper::ConvertDigitsToFht(digitsPtr2, length2, data2.data(), data2.size(), bits, GetFhtThreadCount(), nullptr);
+
+		PooledArray<double> data1(data2.size(), false);
+		PooledArray<UInt32> product(blockLength + length2, false);
+
+		double roundingError, maxRoundingError = 0.0;
+		DigitHelper::SetBlockDigits(digitsResPtr, length1 + length2, 0U);
+		for (UInt32 offset = 0; offset < length1; offset += blockLength)
+		{
+			UInt32 partLength = length1 - offset < blockLength ? length1 - offset : blockLength;
+			UInt32 productLength = partLength + length2;
+
+			MultiplyAndReverse(digitsPtr1 + offset, partLength, data1, bits, data2.data());
+			roundingError = FhtHelper::ConvertDoubleToDigits(data1.data(), data1.size(), productLength, product.data(), bits);
+			if (roundingError > maxRoundingError)
+			{
+				maxRoundingError = roundingError;
+			} // end if
+
+			// Only lower length2 digits of this block result are already filled (by the previous block product)
+			DigitOpHelper::Add(product.data(), productLength, digitsResPtr + offset, length2, digitsResPtr + offset);
+		} // end for
+
+		return maxRoundingError;
+	} // end function MultiplyByBlocks
+
+	/// <summary>
+	/// Returns residues of big integer modulo 2^64 - 1 and <see cref="Constants::FhtCheckPrime" />.
+	/// </summary>
+	/// <param name="digits">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="residue">Resulting residue modulo 2^64 - 1 (may be 2^64 - 1 instead of 0).</param>
+	/// <param name="primeResidue">Resulting residue modulo prime.</param>
+	static void GetResidues(const UInt32 *digits, const UInt32 length, UInt64 &residue, UInt32 &primeResidue)
+	{
+		UInt64 primeResidue64 = 0;
+		residue = 0;
+		for (UInt32 i = length; i-- > 0;)
+		{
+			// 2^64 = 1 modulo 2^64 - 1, so odd digits are just upper halves of 64-bit words
+			residue = AddModulo64(residue, (i & 1) != 0 ? (UInt64)digits[i] << 32 : (UInt64)digits[i]);
+			primeResidue64 = (primeResidue64 << 32 | digits[i]) % Constants::FhtCheckPrime;
+		} // end for
+		primeResidue = (UInt32)primeResidue64;
+	} // end function GetResidues
+
+	/// <summary>
+	/// Adds residues modulo 2^64 - 1 (carry out of 64 bits is added back since 2^64 = 1).
+	/// </summary>
+	static UInt64 AddModulo64(const UInt64 residue1, const UInt64 residue2)
+	{
+		UInt64 sum = residue1 + residue2;
+		return sum < residue1 ? sum + 1 : sum;
+	} // end function AddModulo64
+
+	/// <summary>
+	/// Multiplies residues modulo 2^64 - 1: products of their 32-bit halves are added, the middle ones
+	/// are multiplied by 2^32 (which is just rotation of 64 bits).
+	/// </summary>
+	static UInt64 MultiplyModulo64(const UInt64 residue1, const UInt64 residue2)
+	{
+		UInt64 low1 = (UInt32)residue1, high1 = residue1 >> 32, low2 = (UInt32)residue2, high2 = residue2 >> 32;
+		UInt64 middle = AddModulo64(low1 * high2, high1 * low2);
+		return AddModulo64(AddModulo64(low1 * low2, high1 * high2), middle << 32 | middle >> 32);
+	} // end function MultiplyModulo64
 
 }; // end class AutoFhtMultiplier
 
@@ -34,6 +34,12 @@ public:
 		UInt32 length2 = vlength2;
 		UInt64 c;
 
+		// The same digits are squared
+		if (digitsPtr1 == digitsPtr2 && length1 == length2)
+		{
+			return Sqr(digitsPtr1, length1, digitsResPtr);
+		} // end if
+
 		// External cycle must be always smaller
 		if (length1 < length2)
 		{
@@ -56,6 +62,37 @@ public:
 
 		// Perform digits multiplication
 		UInt32* ptr1 = nullptr, *ptrRes = nullptr;
+
+#ifdef INTX_64BIT_KERNELS
+		// Multiply by pairs of second big integer digits (each row writes two carry digits)
+		UInt32 length1Even = length1 & ~1U;
+		for (; digitsPtr2 + 1 < digitsPtr2End; digitsPtr2 += 2, digitsResPtr += 2)
+		{
+			UInt64 digit2 = DigitHelper::Load64(digitsPtr2);
+			if (digit2 == 0) continue;
+
+			UInt64 c64 = 0;
+			UInt128 product;
+			UInt32 i = 0;
+			for (; i < length1Even; i += 2)
+			{
+				product = (UInt128)digit2 * DigitHelper::Load64(digitsPtr1 + i) + DigitHelper::Load64(digitsResPtr + i) + c64;
+				DigitHelper::Store64(digitsResPtr + i, (UInt64)product);
+				c64 = (UInt64)(product >> 64);
+			} // end for
+
+			// Last odd digit of first big integer
+			if (i < length1)
+			{
+				product = (UInt128)digit2 * digitsPtr1[i] + digitsResPtr[i] + c64;
+				digitsResPtr[i++] = (UInt32)product;
+				c64 = (UInt64)(product >> 32);
+			} // end if
+
+			DigitHelper::Store64(digitsResPtr + i, c64);
+		} // end for
+#endif // INTX_64BIT_KERNELS
+
 		for (; digitsPtr2 < digitsPtr2End; ++digitsPtr2, ++digitsResPtr)
 		{
 			// Check for zero (sometimes may help). There is no sense to make this check in internal cycle -
@@ -73,7 +110,7 @@ public:
 		} // end for
 
 		UInt32 newLength = length1 + length2;
-		if (newLength > 0 && (ptrRes == nullptr || *ptrRes == 0))
+		if (newLength > 0 && digitsResPtr[length1 - 1] == 0)
 		{
 			--newLength;
 		} // end if
@@ -81,6 +118,151 @@ public:
 		return newLength;
 	} // end function Multiply
 
+	/// <summary>
+	/// Squares big integer using pointers.
+	/// Each product of two different digits is computed once and doubled, so it takes about half of multiplications.
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits (they can't overlap with source ones).</param>
+	/// <returns>Resulting big integer length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr)
+	{
+		UInt32 newLength = 2 * length;
+		DigitHelper::SetBlockDigits(digitsResPtr, newLength, 0U);
+
+#ifdef INTX_64BIT_KERNELS
+		// Square by pairs of digits; the last odd digit d is added later: (x + d * B^k)^2 = x^2 + 2 * d * x * B^k + d^2 * B^2k
+		UInt32 evenLength = length & ~1U;
+		SqrPairs(digitsPtr, evenLength / 2, digitsResPtr);
+		if (evenLength != length)
+		{
+			UInt32 digit = digitsPtr[evenLength];
+			AddMultipliedDigits(digitsPtr, evenLength, digit, digitsResPtr + evenLength);
+			AddMultipliedDigits(digitsPtr, evenLength, digit, digitsResPtr + evenLength);
+
+			UInt64 square = (UInt64)digit * digit;
+			UInt64 c = (UInt64)digitsResPtr[2 * evenLength] + (UInt32)square;
+			digitsResPtr[2 * evenLength] = (UInt32)c;
+			digitsResPtr[2 * evenLength + 1] += (UInt32)(c >> 32) + (UInt32)(square >> 32);
+		} // end if
+#else
+		SqrDigits(digitsPtr, length, digitsResPtr);
+#endif // INTX_64BIT_KERNELS
+
+		if (newLength > 0 && digitsResPtr[newLength - 1] == 0)
+		{
+			--newLength;
+		} // end if
+
+		return newLength;
+	} // end function Sqr
+
+private:
+
+	/// <summary>
+	/// Squares digits: products of different digits are summed, doubled, and then squares of digits are added.
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting digits (2 * <paramref name="length" /> zeroed digits).</param>
+	static void SqrDigits(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr)
+	{
+		UInt64 c;
+		for (UInt32 i = 0; i + 1 < length; ++i)
+		{
+			UInt32 digit = digitsPtr[i];
+			if (digit == 0) continue;
+
+			c = 0;
+			for (UInt32 j = i + 1; j < length; ++j)
+			{
+				c += (UInt64)digit * digitsPtr[j] + digitsResPtr[i + j];
+				digitsResPtr[i + j] = (UInt32)c;
+				c >>= 32;
+			} // end for
+			digitsResPtr[i + length] = (UInt32)c;
+		} // end for
+
+		// Double and add squares (two resulting digits for each source one)
+		UInt32 shiftedBit = 0;
+		c = 0;
+		for (UInt32 i = 0; i < length; ++i)
+		{
+			UInt32 low = digitsResPtr[2 * i], high = digitsResPtr[2 * i + 1];
+			UInt64 square = (UInt64)digitsPtr[i] * digitsPtr[i];
+
+			c += (UInt64)(low << 1 | shiftedBit) + (UInt32)square;
+			digitsResPtr[2 * i] = (UInt32)c;
+			c = (c >> 32) + (UInt32)(high << 1 | low >> 31) + (square >> 32);
+			digitsResPtr[2 * i + 1] = (UInt32)c;
+			c >>= 32;
+			shiftedBit = high >> 31;
+		} // end for
+	} // end function SqrDigits
+
+#ifdef INTX_64BIT_KERNELS
+	/// <summary>
+	/// Squares digits by pairs (the same way as <see cref="SqrDigits" /> does it for single digits).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="pairCount">Count of digit pairs.</param>
+	/// <param name="digitsResPtr">Resulting digits (4 * <paramref name="pairCount" /> zeroed digits).</param>
+	static void SqrPairs(const UInt32 *digitsPtr, const UInt32 pairCount, UInt32 *digitsResPtr)
+	{
+		UInt128 product;
+		for (UInt32 i = 0; i + 1 < pairCount; ++i)
+		{
+			UInt64 pair = DigitHelper::Load64(digitsPtr + 2 * i);
+			if (pair == 0) continue;
+
+			UInt64 c64 = 0;
+			for (UInt32 j = i + 1; j < pairCount; ++j)
+			{
+				product = (UInt128)pair * DigitHelper::Load64(digitsPtr + 2 * j) + DigitHelper::Load64(digitsResPtr + 2 * (i + j)) + c64;
+				DigitHelper::Store64(digitsResPtr + 2 * (i + j), (UInt64)product);
+				c64 = (UInt64)(product >> 64);
+			} // end for
+			DigitHelper::Store64(digitsResPtr + 2 * (i + pairCount), c64);
+		} // end for
+
+		// Double and add squares (two resulting pairs for each source one)
+		UInt64 shiftedBit = 0, c64 = 0;
+		for (UInt32 i = 0; i < pairCount; ++i)
+		{
+			UInt64 low = DigitHelper::Load64(digitsResPtr + 4 * i), high = DigitHelper::Load64(digitsResPtr + 4 * i + 2);
+			UInt64 pair = DigitHelper::Load64(digitsPtr + 2 * i);
+			UInt128 square = (UInt128)pair * pair;
+
+			product = (UInt128)(low << 1 | shiftedBit) + (UInt64)square + c64;
+			DigitHelper::Store64(digitsResPtr + 4 * i, (UInt64)product);
+			product = (product >> 64) + (high << 1 | low >> 63) + (UInt64)(square >> 64);
+			DigitHelper::Store64(digitsResPtr + 4 * i + 2, (UInt64)product);
+			c64 = (UInt64)(product >> 64);
+			shiftedBit = high >> 63;
+		} // end for
+	} // end function SqrPairs
+
+	// Adds digits multiplied by one digit to the result (carry is propagated as far as needed).
+	static void AddMultipliedDigits(const UInt32 *digitsPtr, const UInt32 length, const UInt32 digit, UInt32 *digitsResPtr)
+	{
+		UInt64 c = 0;
+		UInt32 i = 0;
+		for (; i < length; ++i)
+		{
+			c += (UInt64)digit * digitsPtr[i] + digitsResPtr[i];
+			digitsResPtr[i] = (UInt32)c;
+			c >>= 32;
+		} // end for
+		for (; c != 0; ++i)
+		{
+			c += digitsResPtr[i];
+			digitsResPtr[i] = (UInt32)c;
+			c >>= 32;
+		} // end for
+	} // end function AddMultipliedDigits
+#endif // INTX_64BIT_KERNELS
+
 }; // end class ClassicMultiplier
 
 #endif // !CLASSICMULTIPLIER_H
@@ -9,6 +9,7 @@ typedef unsigned int UInt32;
 
 #include <vector>
 #include "../IntX.h"
+#include "PreparedOperand.h"
 
 using namespace std;
 
@@ -38,6 +39,38 @@ public:
 	/// <returns>Resulting big integer real length.</returns>
 	virtual UInt32 Multiply(const UInt32 *digits1, const UInt32 length1, const UInt32 *digits2, const UInt32 length2, UInt32 *digitsRes) = 0;
 
+	/// <summary>
+	/// Squares big integer.
+	/// </summary>
+	/// <param name="value">Big integer.</param>
+	/// <returns>Resulting big integer.</returns>
+	virtual IntX Sqr(const IntX &value) = 0;
+
+	/// <summary>
+	/// Squares big integer represented by its digits.
+	/// </summary>
+	/// <param name="digits">Big integer digits.</param>
+	/// <param name="length">Big integer real length.</param>
+	/// <param name="digitsRes">Where to put resulting big integer (2 * <paramref name="length" /> digits).</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digits, const UInt32 length, UInt32 *digitsRes) = 0;
+
+	/// <summary>
+	/// Prepares big integer for repeated multiplication (transforms it once if multiplier uses transforms).
+	/// </summary>
+	/// <param name="operand">Big integer to prepare.</param>
+	virtual void Prepare(PreparedOperand &operand) = 0;
+
+	/// <summary>
+	/// Multiplies prepared big integer by other one represented by its digits.
+	/// </summary>
+	/// <param name="operand">Prepared big integer.</param>
+	/// <param name="digits2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer real length (not bigger than <c>operand.otherLengthMax</c>).</param>
+	/// <param name="digitsRes">Where to put resulting big integer.</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Multiply(const PreparedOperand &operand, const UInt32 *digits2, const UInt32 length2, UInt32 *digitsRes) = 0;
+
 }; // end class IMultiplier
 
 #endif // !IMULTIPLIER_H
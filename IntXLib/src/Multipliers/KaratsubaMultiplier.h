@@ -0,0 +1,242 @@
+#pragma once
+
+#ifndef KARATSUBAMULTIPLIER_H
+#define KARATSUBAMULTIPLIER_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "IMultiplier.h"
+#include "MultiplierBase.h"
+#include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
+#include "../OpHelpers/DigitHelper.h"
+#include "../OpHelpers/DigitOpHelper.h"
+
+using namespace std;
+
+// Multiplies using Karatsuba algorithm.
+// Time estimate is O(n ^ 1.585), so it's faster than classic one for middle-sized big integers.
+class KaratsubaMultiplier : public MultiplierBase
+{
+public:
+
+	/// <summary>
+	/// Creates new <see cref="KaratsubaMultiplier" /> instance.
+	/// </summary>
+	/// <param name="classicMultiplier">Multiplier used for short parts (shorter than <see cref="Constants::KaratsubaLengthLowerBound" />).</param>
+	KaratsubaMultiplier(IMultiplier &classicMultiplier)
+	{
+		_classicMultiplier = &classicMultiplier;
+	} // end .cctr
+
+	/// <summary>
+	/// Multiplies two big integers using pointers.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer length.</returns>
+	virtual UInt32 Multiply(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use classic multiplier instead
+		if (length1 < Constants::KaratsubaLengthLowerBound || length2 < Constants::KaratsubaLengthLowerBound)
+		{
+			return _classicMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+		} // end if
+
+		// The same digits are squared
+		if (digitsPtr1 == digitsPtr2 && length1 == length2)
+		{
+			return Sqr(digitsPtr1, length1, digitsResPtr);
+		} // end if
+
+		// First must be bigger
+		if (length1 < length2)
+		{
+			return Multiply(digitsPtr2, length2, digitsPtr1, length1, digitsResPtr);
+		} // end if
+
+		PooledArray<UInt32> buffer(GetBufferLength(length1), false);
+		MultiplyDigits(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr, buffer.data());
+
+		UInt32 newLength = length1 + length2;
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function Multiply
+
+	/// <summary>
+	/// Squares big integer using pointers.
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use classic multiplier instead
+		if (length < Constants::KaratsubaSqrLengthLowerBound)
+		{
+			return _classicMultiplier->Sqr(digitsPtr, length, digitsResPtr);
+		} // end if
+
+		PooledArray<UInt32> buffer(GetBufferLength(length), false);
+		SqrDigits(digitsPtr, length, digitsResPtr, buffer.data());
+
+		UInt32 newLength = 2 * length;
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function Sqr
+
+private:
+	IMultiplier *_classicMultiplier;
+
+	/// <summary>
+	/// Returns length of temporary buffer enough to multiply big integer of given length by shorter one.
+	/// Each recursion level takes about 2 * <paramref name="length" /> digits and halves the length.
+	/// </summary>
+	/// <param name="length">Length of the longer big integer.</param>
+	static UInt32 GetBufferLength(const UInt32 length)
+	{
+		return 4U * length + 16U * 32U;
+	} // end function GetBufferLength
+
+	/// <summary>
+	/// Multiplies digits recursively. All <paramref name="length1" /> + <paramref name="length2" /> resulting digits are written.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length (not less than <paramref name="length2" />).</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting digits (they can't overlap with multipliers).</param>
+	/// <param name="bufferPtr">Temporary buffer (see <see cref="GetBufferLength" />).</param>
+	void MultiplyDigits(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		UInt32 *digitsResPtr, UInt32 *bufferPtr)
+	{
+		if (length2 < Constants::KaratsubaLengthLowerBound)
+		{
+			// Classic multiplier expects zeroes after the first length1 resulting digits
+			DigitHelper::SetBlockDigits(digitsResPtr + length1, length2, 0U);
+			_classicMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+			return;
+		} // end if
+
+		UInt32 splitLength = (length1 + 1) / 2;
+		if (length2 <= splitLength)
+		{
+			MultiplyUnbalanced(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr, bufferPtr);
+			return;
+		} // end if
+
+		// x = x1 * B^splitLength + x0 (the same for y)
+		const UInt32 *x0 = digitsPtr1, *x1 = digitsPtr1 + splitLength;
+		const UInt32 *y0 = digitsPtr2, *y1 = digitsPtr2 + splitLength;
+		UInt32 x1Length = length1 - splitLength;
+		UInt32 y1Length = length2 - splitLength;
+
+		// Lower and higher products are placed right into the result
+		UInt32 *z0 = digitsResPtr, *z2 = digitsResPtr + 2 * splitLength;
+		MultiplyDigits(x0, splitLength, y0, splitLength, z0, bufferPtr);
+		MultiplyDigits(x1, x1Length, y1, y1Length, z2, bufferPtr);
+
+		// Middle product (x0 + x1) * (y0 + y1)
+		UInt32 sumLength = splitLength + 1;
+		UInt32 *xSum = bufferPtr, *ySum = bufferPtr + sumLength, *z1 = bufferPtr + 2 * sumLength;
+		SumParts(x0, splitLength, x1, x1Length, xSum);
+		SumParts(y0, splitLength, y1, y1Length, ySum);
+		MultiplyDigits(xSum, sumLength, ySum, sumLength, z1, z1 + 2 * sumLength);
+
+		// z1 - z0 - z2 is added to result shifted by splitLength digits
+		UInt32 z1Length = DigitHelper::GetRealDigitsLength(z1, 2 * sumLength);
+		z1Length = DigitOpHelper::Sub(z1, z1Length, z0, DigitHelper::GetRealDigitsLength(z0, 2 * splitLength), z1);
+		z1Length = DigitOpHelper::Sub(z1, z1Length, z2, DigitHelper::GetRealDigitsLength(z2, x1Length + y1Length), z1);
+		UInt32 restLength = length1 + length2 - splitLength;
+		DigitOpHelper::Add(digitsResPtr + splitLength, restLength, z1, z1Length, digitsResPtr + splitLength);
+	} // end function MultiplyDigits
+
+	/// <summary>
+	/// Squares digits recursively: (x1 * B^k + x0)^2 = x1^2 * B^2k + ((x0 + x1)^2 - x0^2 - x1^2) * B^k + x0^2.
+	/// All 2 * <paramref name="length" /> resulting digits are written.
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting digits (they can't overlap with source ones).</param>
+	/// <param name="bufferPtr">Temporary buffer (see <see cref="GetBufferLength" />).</param>
+	void SqrDigits(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr, UInt32 *bufferPtr)
+	{
+		if (length < Constants::KaratsubaSqrLengthLowerBound)
+		{
+			_classicMultiplier->Sqr(digitsPtr, length, digitsResPtr);
+			return;
+		} // end if
+
+		UInt32 splitLength = (length + 1) / 2;
+		const UInt32 *x0 = digitsPtr, *x1 = digitsPtr + splitLength;
+		UInt32 x1Length = length - splitLength;
+
+		// Lower and higher squares are placed right into the result
+		UInt32 *z0 = digitsResPtr, *z2 = digitsResPtr + 2 * splitLength;
+		SqrDigits(x0, splitLength, z0, bufferPtr);
+		SqrDigits(x1, x1Length, z2, bufferPtr);
+
+		// Middle square (x0 + x1)^2
+		UInt32 sumLength = splitLength + 1;
+		UInt32 *xSum = bufferPtr, *z1 = bufferPtr + sumLength;
+		SumParts(x0, splitLength, x1, x1Length, xSum);
+		SqrDigits(xSum, sumLength, z1, z1 + 2 * sumLength);
+
+		// z1 - z0 - z2 is added to result shifted by splitLength digits
+		UInt32 z1Length = DigitHelper::GetRealDigitsLength(z1, 2 * sumLength);
+		z1Length = DigitOpHelper::Sub(z1, z1Length, z0, DigitHelper::GetRealDigitsLength(z0, 2 * splitLength), z1);
+		z1Length = DigitOpHelper::Sub(z1, z1Length, z2, DigitHelper::GetRealDigitsLength(z2, 2 * x1Length), z1);
+		UInt32 restLength = 2 * length - splitLength;
+		DigitOpHelper::Add(digitsResPtr + splitLength, restLength, z1, z1Length, digitsResPtr + splitLength);
+	} // end function SqrDigits
+
+	/// <summary>
+	/// Multiplies long big integer by a much shorter one: longer one is cut into pieces of the shorter
+	/// one length and their products are accumulated.
+	/// </summary>
+	void MultiplyUnbalanced(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		UInt32 *digitsResPtr, UInt32 *bufferPtr)
+	{
+		UInt32 *productPtr = bufferPtr;
+		UInt32 *nextBufferPtr = bufferPtr + 2 * length2;
+
+		DigitHelper::SetBlockDigits(digitsResPtr, length1 + length2, 0U);
+		for (UInt32 offset = 0; offset < length1; offset += length2)
+		{
+			UInt32 partLength = length1 - offset < length2 ? length1 - offset : length2;
+			if (partLength >= length2)
+			{
+				MultiplyDigits(digitsPtr1 + offset, partLength, digitsPtr2, length2, productPtr, nextBufferPtr);
+			} // end if
+			else
+			{
+				MultiplyDigits(digitsPtr2, length2, digitsPtr1 + offset, partLength, productPtr, nextBufferPtr);
+			} // end else
+
+			// Only lower length2 digits are already filled here (by the previous product)
+			UInt32 productLength = DigitHelper::GetRealDigitsLength(productPtr, partLength + length2);
+			DigitOpHelper::Add(productPtr, productLength, digitsResPtr + offset, length2, digitsResPtr + offset);
+		} // end for
+	} // end function MultiplyUnbalanced
+
+	/// <summary>
+	/// Adds higher part of big integer to its lower part.
+	/// </summary>
+	/// <param name="lowPtr">Lower part digits.</param>
+	/// <param name="lowLength">Lower part length (not less than higher part length).</param>
+	/// <param name="highPtr">Higher part digits.</param>
+	/// <param name="highLength">Higher part length.</param>
+	/// <param name="sumPtr">Sum digits (<paramref name="lowLength" /> + 1 digits are written).</param>
+	static void SumParts(const UInt32 *lowPtr, const UInt32 lowLength, const UInt32 *highPtr, const UInt32 highLength, UInt32 *sumPtr)
+	{
+		sumPtr[lowLength] = 0;
+		DigitOpHelper::Add(lowPtr, lowLength, highPtr, highLength, sumPtr);
+	} // end function SumParts
+
+}; // end class KaratsubaMultiplier
+
+#endif // !KARATSUBAMULTIPLIER_H
@@ -36,9 +36,12 @@ public:
 		// Special behavior for zero cases
 		if (int1.length == 0 || int2.length == 0) return IntX();
 
+		// The same digits (or the same object) are squared; copies sharing digits may differ in sign
+		if (int1.digits.data() == int2.digits.data() && int1.length == int2.length && int1.negative == int2.negative) return Sqr(int1);
+
 		// Get new big integer length and check it
 		UInt64 newLength = (UInt64)int1.length + (UInt64)int2.length;
-		if (newLength >> 32 != 0)
+		if (newLength > Constants::MaxIntValue)
 		{
 			throw ArgumentException(Strings::IntegerTooBig);
 		} // end if
@@ -47,7 +50,7 @@ public:
 		IntX newInt = IntX((UInt32)newLength, int1.negative ^ int2.negative);
 
 		// Perform actual digits multiplication
-		newInt.length = Multiply(int1.digits, int1.length, int2.digits, int2.length, newInt.digits);
+		newInt.length = Multiply(int1.digits.data(), int1.length, int2.digits.data(), int2.length, newInt.digits.data());
 
 		// Normalization may be needed
 		newInt.TryNormalize();
@@ -55,14 +58,6 @@ public:
 		return newInt;
 	} // end function Multiply
 
-	UInt32 Multiply(const vector<UInt32> &vdigitsPtr1, const UInt32 length1, const vector<UInt32> &vdigitsPtr2, const UInt32 length2, vector<UInt32> &vdigitsResPtr)
-	{
-		const UInt32* digitsPtr1 = &vdigitsPtr1[0], *digitsPtr2 = &vdigitsPtr2[0];
-		UInt32 *digitsResPtr = &vdigitsResPtr[0];
-
-		return Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
-	} // end function Multiply
-
 	/// <summary>
 	/// Multiplies two big integers using pointers.
 	/// </summary>
@@ -73,6 +68,66 @@ public:
 	/// <param name="digitsResPtr">Resulting big integer digits.</param>
 	/// <returns>Resulting big integer length.</returns>
 	virtual UInt32 Multiply(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr) = 0;
+
+	/// <summary>
+	/// Squares big integer.
+	/// </summary>
+	/// <param name="value">Big integer.</param>
+	/// <returns>Resulting big integer.</returns>
+	/// <exception cref="ArgumentException"><paramref name="value" /> is too big for multiply operation.</exception>
+	virtual IntX Sqr(const IntX &value)
+	{
+		// Special behavior for zero case
+		if (value.length == 0) return IntX();
+
+		// Get new big integer length and check it
+		UInt64 newLength = 2 * (UInt64)value.length;
+		if (newLength > Constants::MaxIntValue)
+		{
+			throw ArgumentException(Strings::IntegerTooBig);
+		} // end if
+
+		// Create resulting big int (square is never negative)
+		IntX newInt = IntX((UInt32)newLength, false);
+
+		// Perform actual digits squaring
+		newInt.length = Sqr(value.digits.data(), value.length, newInt.digits.data());
+
+		// Normalization may be needed
+		newInt.TryNormalize();
+
+		return newInt;
+	} // end function Sqr
+
+	/// <summary>
+	/// Squares big integer using pointers.
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits (2 * <paramref name="length" /> digits).</param>
+	/// <returns>Resulting big integer length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr) = 0;
+
+	/// <summary>
+	/// Prepares big integer for repeated multiplication (nothing is done by default).
+	/// </summary>
+	/// <param name="operand">Big integer to prepare.</param>
+	virtual void Prepare(PreparedOperand & /* operand */)
+	{
+	} // end function Prepare
+
+	/// <summary>
+	/// Multiplies prepared big integer by other one using pointers (usual multiplication by default).
+	/// </summary>
+	/// <param name="operand">Prepared big integer.</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer length.</returns>
+	virtual UInt32 Multiply(const PreparedOperand &operand, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		return Multiply(operand.digitsPtr, operand.length, digitsPtr2, length2, digitsResPtr);
+	} // end function Multiply
 }; // end class MultiplierBase
 
 #endif // !MULTIPLIERBASE_H
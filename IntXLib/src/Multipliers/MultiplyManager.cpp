@@ -4,5 +4,20 @@
 // Classic multiplier instance.
 ClassicMultiplier MultiplyManager::_ClassicMultiplier = ClassicMultiplier();
 
-// FHT multiplier instance.
-AutoFhtMultiplier MultiplyManager::_AutoFhtMultiplier = AutoFhtMultiplier(MultiplyManager::_ClassicMultiplier);
\ No newline at end of file
+// Karatsuba multiplier instance.
+KaratsubaMultiplier MultiplyManager::_KaratsubaMultiplier = KaratsubaMultiplier(MultiplyManager::_ClassicMultiplier);
+
+// Toom-3 multiplier instance (Karatsuba one is used for shorter big integers).
+ToomCookMultiplier MultiplyManager::_Toom3Multiplier = ToomCookMultiplier(3, Constants::Toom3LengthLowerBound, MultiplyManager::_KaratsubaMultiplier);
+
+// Toom-4 multiplier instance (Toom-3 one is used for shorter big integers).
+ToomCookMultiplier MultiplyManager::_Toom4Multiplier = ToomCookMultiplier(4, Constants::Toom4LengthLowerBound, MultiplyManager::_Toom3Multiplier);
+
+// NTT multiplier instance (Toom-4 one is used for shorter big integers).
+NttMultiplier MultiplyManager::_NttMultiplier = NttMultiplier(MultiplyManager::_Toom4Multiplier);
+
+// Schonhage-Strassen multiplier instance (NTT one is used for shorter big integers and short pointwise products).
+SchonhageStrassenMultiplier MultiplyManager::_SchonhageStrassenMultiplier = SchonhageStrassenMultiplier(MultiplyManager::_NttMultiplier);
+
+// FHT multiplier instance (Toom-4 one is used for shorter big integers and NTT one for too long ones).
+AutoFhtMultiplier MultiplyManager::_AutoFhtMultiplier = AutoFhtMultiplier(MultiplyManager::_Toom4Multiplier, MultiplyManager::_NttMultiplier);
\ No newline at end of file
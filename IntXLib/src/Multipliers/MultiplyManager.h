@@ -5,6 +5,10 @@
 
 #include "IMultiplier.h"
 #include "ClassicMultiplier.h"
+#include "KaratsubaMultiplier.h"
+#include "ToomCookMultiplier.h"
+#include "NttMultiplier.h"
+#include "SchonhageStrassenMultiplier.h"
 #include "AutoFhtMultiplier.h"
 #include "../IntX.h"
 
@@ -16,6 +20,21 @@ private:
 	// Classic multiplier instance.
 	static ClassicMultiplier _ClassicMultiplier;
 
+	// Karatsuba multiplier instance.
+	static KaratsubaMultiplier _KaratsubaMultiplier;
+
+	// Toom-3 multiplier instance.
+	static ToomCookMultiplier _Toom3Multiplier;
+
+	// Toom-4 multiplier instance.
+	static ToomCookMultiplier _Toom4Multiplier;
+
+	// NTT multiplier instance.
+	static NttMultiplier _NttMultiplier;
+
+	// Schonhage-Strassen multiplier instance.
+	static SchonhageStrassenMultiplier _SchonhageStrassenMultiplier;
+
 	// FHT multiplier instance.
 	static AutoFhtMultiplier _AutoFhtMultiplier;
 
@@ -36,6 +55,16 @@ public:
 			return &_AutoFhtMultiplier;
 		case MultiplyMode::mmClassic:
 			return &_ClassicMultiplier;
+		case MultiplyMode::mmKaratsuba:
+			return &_KaratsubaMultiplier;
+		case MultiplyMode::mmToom3:
+			return &_Toom3Multiplier;
+		case MultiplyMode::mmToom4:
+			return &_Toom4Multiplier;
+		case MultiplyMode::mmNtt:
+			return &_NttMultiplier;
+		case MultiplyMode::mmSchonhageStrassen:
+			return &_SchonhageStrassenMultiplier;
 		default:
 			throw ArgumentOutOfRangeException("mode");
 		} // end switch
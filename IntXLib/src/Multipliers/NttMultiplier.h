@@ -0,0 +1,127 @@
+#pragma once
+
+#ifndef NTTMULTIPLIER_H
+#define NTTMULTIPLIER_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "IMultiplier.h"
+#include "MultiplierBase.h"
+#include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
+#include "../OpHelpers/NttHelper.h"
+
+using namespace std;
+
+// Multiplies using number-theoretic transform (NTT).
+// Unlike FHT it's exact, so it needs no result validity check and works for big integers of any length.
+class NttMultiplier : public MultiplierBase
+{
+public:
+
+	/// <summary>
+	/// Creates new <see cref="NttMultiplier" /> instance.
+	/// </summary>
+	/// <param name="lowerMultiplier">Multiplier used for big integers shorter than <see cref="Constants::NttLengthLowerBound" />.</param>
+	NttMultiplier(IMultiplier &lowerMultiplier)
+	{
+		_lowerMultiplier = &lowerMultiplier;
+	} // end .cctr
+
+	/// <summary>
+	/// Multiplies two big integers using pointers.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Multiply(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		// The same digits are squared
+		if (digitsPtr1 == digitsPtr2 && length1 == length2)
+		{
+			return Sqr(digitsPtr1, length1, digitsResPtr);
+		} // end if
+
+		// Check length - maybe use lower multiplier instead
+		if (length1 < Constants::NttLengthLowerBound || length2 < Constants::NttLengthLowerBound)
+		{
+			return _lowerMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+		} // end if
+
+		return MultiplyByTransform(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+	} // end function Multiply
+
+	/// <summary>
+	/// Squares big integer using pointers (only one NTT is done for each prime).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use lower multiplier instead
+		if (length < Constants::NttLengthLowerBound)
+		{
+			return _lowerMultiplier->Sqr(digitsPtr, length, digitsResPtr);
+		} // end if
+
+		return MultiplyByTransform(digitsPtr, length, digitsPtr, length, digitsResPtr);
+	} // end function Sqr
+
+private:
+	IMultiplier *_lowerMultiplier;
+
+	/// <summary>
+	/// Multiplies two big integers using NTT modulo each prime (the same digits are squared).
+	/// </summary>
+	UInt32 MultiplyByTransform(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		UInt32 newLength = length1 + length2;
+		UInt32 transformLength = NttHelper::GetTransformLength(length1, length2);
+		bool square = digitsPtr1 == digitsPtr2 && length1 == length2;
+
+		PooledArray<UInt64> twiddles(transformLength, false);
+		PooledArray<UInt64> data2(square ? 0 : transformLength, false);
+		PooledArray<UInt64> residues0(transformLength, false);
+		PooledArray<UInt64> residues1(transformLength, false);
+		PooledArray<UInt64> residues2(transformLength, false);
+		UInt64 *residues[NttHelper::PrimeCount] = { residues0.data(), residues1.data(), residues2.data() };
+
+		// Multiply modulo each prime
+		for (int i = 0; i < NttHelper::PrimeCount; ++i)
+		{
+			const NttHelper::NttPrime &prime = NttHelper::Primes[i];
+			UInt64 *data1 = residues[i];
+			NttHelper::FillTwiddles(twiddles.data(), transformLength, prime);
+
+			NttHelper::ConvertDigitsToResidues(digitsPtr1, length1, data1, transformLength, prime);
+			NttHelper::Ntt(data1, transformLength, twiddles.data(), prime);
+			if (square)
+			{
+				// Use the same NTT for equal big integers
+				NttHelper::MultiplyNttResults(data1, data1, transformLength, prime);
+			} // end if
+			else
+			{
+				NttHelper::ConvertDigitsToResidues(digitsPtr2, length2, data2.data(), transformLength, prime);
+				NttHelper::Ntt(data2.data(), transformLength, twiddles.data(), prime);
+				NttHelper::MultiplyNttResults(data1, data2.data(), transformLength, prime);
+			} // end else
+			NttHelper::ReverseNtt(data1, transformLength, twiddles.data(), prime);
+		} // end for
+
+		// Restore digits from residues
+		NttHelper::ConvertResiduesToDigits(residues, transformLength, newLength, digitsResPtr);
+
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function MultiplyByTransform
+
+}; // end class NttMultiplier
+
+#endif // !NTTMULTIPLIER_H
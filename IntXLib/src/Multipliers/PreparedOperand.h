@@ -0,0 +1,47 @@
+#pragma once
+
+#ifndef PREPAREDOPERAND_H
+#define PREPAREDOPERAND_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "../Utils/ArrayPool.h"
+
+using namespace std;
+
+// Big integer which is going to be multiplied many times by other ones (not longer than given length).
+// Multiplier may keep its transform here (see <see cref="IMultiplier::Prepare" />), so it's done only once.
+// Big integer digits aren't copied - they must stay unchanged while operand is in use.
+class PreparedOperand
+{
+public:
+
+	/// <summary>
+	/// Creates new <see cref="PreparedOperand" /> instance (it must be prepared by multiplier before use).
+	/// </summary>
+	/// <param name="vdigitsPtr">Big integer digits.</param>
+	/// <param name="vlength">Big integer length.</param>
+	/// <param name="votherLengthMax">Maximal length of big integers it will be multiplied by.</param>
+	PreparedOperand(const UInt32 *vdigitsPtr, const UInt32 vlength, const UInt32 votherLengthMax)
+		: digitsPtr(vdigitsPtr), length(vlength), otherLengthMax(votherLengthMax), spectrum(0)
+	{
+	} // end .cctr
+
+	// Big integer digits.
+	const UInt32 *digitsPtr;
+
+	// Big integer length.
+	UInt32 length;
+
+	// Maximal length of big integers it will be multiplied by.
+	UInt32 otherLengthMax;
+
+	// Transformed digits (FHT ones, for multiplication result length of length + otherLengthMax);
+	// empty if multiplier doesn't use them.
+	PooledArray<double> spectrum;
+
+}; // end class PreparedOperand
+
+#endif // !PREPAREDOPERAND_H
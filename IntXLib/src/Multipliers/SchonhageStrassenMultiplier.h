@@ -0,0 +1,586 @@
+#pragma once
+
+#ifndef SCHONHAGESTRASSENMULTIPLIER_H
+#define SCHONHAGESTRASSENMULTIPLIER_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "IMultiplier.h"
+#include "MultiplierBase.h"
+#include "../Bits.h"
+#include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
+#include "../OpHelpers/DigitHelper.h"
+
+using namespace std;
+
+// Multiplies using Schonhage-Strassen algorithm.
+// Big integers are multiplied modulo 2^(32 * n) + 1 (n is not less than the product length) by negacyclic
+// convolution of their parts. Transform works in the same ring Z/(2^(32 * n') + 1) where roots of unity
+// are powers of 2, so butterflies are just shifts and additions, and pointwise products are computed
+// recursively. Time estimate is O(n * log n * log log n). All the data is kept in exact digits: transform
+// of each operand takes about 2 digits per resulting digit (FHT takes 4 doubles per resulting digit),
+// so temporary memory is about 4 times less than FHT needs.
+//
+// Ring element modulo 2^(32 * n) + 1 is stored in n + 1 digits; it's normalized (less than the modulus),
+// so the highest digit can be 1 only when the element equals 2^(32 * n) (i.e. -1).
+class SchonhageStrassenMultiplier : public MultiplierBase
+{
+public:
+
+	/// <summary>
+	/// Creates new <see cref="SchonhageStrassenMultiplier" /> instance.
+	/// </summary>
+	/// <param name="lowerMultiplier">Multiplier used for short big integers and short pointwise products.</param>
+	SchonhageStrassenMultiplier(IMultiplier &lowerMultiplier)
+	{
+		_lowerMultiplier = &lowerMultiplier;
+	} // end .cctr
+
+	/// <summary>
+	/// Multiplies two big integers using pointers.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Multiply(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use lower multiplier instead
+		if (length1 < Constants::SchonhageStrassenLengthLowerBound || length2 < Constants::SchonhageStrassenLengthLowerBound)
+		{
+			return _lowerMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+		} // end if
+
+		// Product is less than 2^(32 * n) so it's got exactly
+		UInt32 newLength = length1 + length2;
+		int logK = GetLogPartCount(newLength);
+		UInt32 n = RoundUp(newLength, 1U << logK);
+
+		MultiplyByTransform(digitsPtr1, length1, digitsPtr2, length2, n, logK, digitsResPtr, newLength);
+
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function Multiply
+
+	/// <summary>
+	/// Squares big integer using pointers (only one transform is done).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer real length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use lower multiplier instead
+		if (length < Constants::SchonhageStrassenLengthLowerBound)
+		{
+			return _lowerMultiplier->Sqr(digitsPtr, length, digitsResPtr);
+		} // end if
+
+		// Transform of the same digits is reused
+		return Multiply(digitsPtr, length, digitsPtr, length, digitsResPtr);
+	} // end function Sqr
+
+private:
+	IMultiplier *_lowerMultiplier;
+
+	//==================================================================
+	//  Parameters
+	//==================================================================
+
+	// Returns Log2 of count of parts for n-digit multiplication (about square root of bits count).
+	static int GetLogPartCount(const UInt32 n)
+	{
+		int logK = (Bits::Msb(n) + 7) / 2 - 1;
+		return logK < 2 ? 2 : logK;
+	} // end function GetLogPartCount
+
+	static UInt32 RoundUp(const UInt32 value, const UInt32 step)
+	{
+		return (value + step - 1) / step * step;
+	} // end function RoundUp
+
+	// Returns count of trailing zero bits (value must be non-zero).
+	static int TrailingZeros(const UInt32 value)
+	{
+		return Bits::Msb(value & (0U - value));
+	} // end function TrailingZeros
+
+	/// <summary>
+	/// Returns length of ring where products of parts are computed.
+	/// It must fit any convolution item, and 2^(32 * n') must have root of unity of order 2 * K.
+	/// If pointwise products are computed recursively then length has enough factors of 2 for the next level.
+	/// </summary>
+	/// <param name="partLength">Part length.</param>
+	/// <param name="logK">Log2 of parts count.</param>
+	static UInt32 GetRingLength(const UInt32 partLength, const int logK)
+	{
+		UInt32 minLength = 2 * partLength + 1;
+		UInt32 step = logK > 5 ? 1U << (logK - 5) : 1U;
+		if (minLength >= Constants::SchonhageStrassenRecursionBound)
+		{
+			UInt32 nextStep = 1U << GetLogPartCount(minLength);
+			step = step > nextStep ? step : nextStep;
+		} // end if
+		return RoundUp(minLength, step);
+	} // end function GetRingLength
+
+	//==================================================================
+	//  Multiplication
+	//==================================================================
+
+	/// <summary>
+	/// Multiplies two ring elements modulo 2^(32 * n) + 1.
+	/// </summary>
+	/// <param name="a">First element (n + 1 digits).</param>
+	/// <param name="b">Second element (n + 1 digits).</param>
+	/// <param name="n">Ring length.</param>
+	/// <param name="result">Resulting element (n + 1 digits, mustn't overlap with multipliers).</param>
+	void MultiplyModFermat(const UInt32 *a, const UInt32 *b, const UInt32 n, UInt32 *result)
+	{
+		// 2^(32 * n) is -1
+		if (a[n] != 0)
+		{
+			Negate(b, n, result);
+			return;
+		} // end if
+		if (b[n] != 0)
+		{
+			Negate(a, n, result);
+			return;
+		} // end if
+
+		int logK = GetLogPartCount(n);
+		int factorsOf2 = TrailingZeros(n);
+		logK = logK < factorsOf2 ? logK : factorsOf2;
+		if (n >= Constants::SchonhageStrassenRecursionBound && logK >= 2)
+		{
+			MultiplyByTransform(a, n, b, n, n, logK, result, n + 1);
+			return;
+		} // end if
+
+		// Short elements are multiplied by lower multiplier and reduced: x1 * 2^(32 * n) + x0 = x0 - x1
+		UInt32 length1 = DigitHelper::GetRealDigitsLength(a, n);
+		UInt32 length2 = DigitHelper::GetRealDigitsLength(b, n);
+		DigitHelper::SetBlockDigits(result, n + 1, 0U);
+		if (length1 == 0 || length2 == 0) return;
+
+		PooledArray<UInt32> product(2 * n, false);
+		DigitHelper::SetBlockDigits(product.data(), 2 * n, 0U);
+		_lowerMultiplier->Multiply(a, length1, b, length2, product.data());
+		SubDigits(product.data(), product.data() + n, n, result);
+	} // end function MultiplyModFermat
+
+	/// <summary>
+	/// Multiplies two big integers (less than 2^(32 * n)) modulo 2^(32 * n) + 1 using negacyclic convolution:
+	/// they are cut into K parts, parts are weighted by powers of 2^(32 * n' / K), transformed,
+	/// multiplied pointwise, transformed back and unweighted.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length (not more than n).</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length (not more than n).</param>
+	/// <param name="n">Ring length (multiple of K).</param>
+	/// <param name="logK">Log2 of parts count K.</param>
+	/// <param name="result">Resulting element.</param>
+	/// <param name="resultLength">Count of lower digits of resulting element to store (not more than n + 1).</param>
+	void MultiplyByTransform(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		const UInt32 n, const int logK, UInt32 *result, const UInt32 resultLength)
+	{
+		UInt32 partCount = 1U << logK;
+		UInt32 partLength = n / partCount;
+		UInt32 ringLength = GetRingLength(partLength, logK);
+		UInt32 elementLength = ringLength + 1;
+		UInt64 rootBitCount = 32ULL * ringLength / partCount; // 2^rootBitCount is root of order 2 * K
+
+		bool square = digitsPtr1 == digitsPtr2 && length1 == length2;
+		PooledArray<UInt32> data1((UInt32)((UInt64)partCount * elementLength), false);
+		PooledArray<UInt32> buffer(2 * elementLength, false);
+
+		Decompose(digitsPtr1, length1, partLength, logK, ringLength, rootBitCount, data1.data(), buffer.data());
+		Transform(data1.data(), logK, ringLength, buffer.data());
+
+		// Second transform is freed right after pointwise products to lower peak memory usage
+		{
+			PooledArray<UInt32> data2(square ? 0 : (UInt32)((UInt64)partCount * elementLength), false);
+			if (!square)
+			{
+				Decompose(digitsPtr2, length2, partLength, logK, ringLength, rootBitCount, data2.data(), buffer.data());
+				Transform(data2.data(), logK, ringLength, buffer.data());
+			} // end if
+
+			// Pointwise products
+			const UInt32 *data2Ptr = square ? data1.data() : data2.data();
+			for (UInt32 i = 0; i < partCount; ++i)
+			{
+				UInt32 *element = data1.data() + (size_t)i * elementLength;
+				MultiplyModFermat(element, data2Ptr + (size_t)i * elementLength, ringLength, buffer.data());
+				DigitHelper::DigitsBlockCopy(buffer.data(), element, elementLength);
+			} // end for
+		}
+
+		ReverseTransform(data1.data(), logK, ringLength, buffer.data());
+		Compose(data1.data(), partLength, logK, ringLength, rootBitCount, n, result, resultLength);
+	} // end function MultiplyByTransform
+
+	//==================================================================
+	//  Transform
+	//==================================================================
+
+	/// <summary>
+	/// Cuts big integer into K parts and multiplies part i by 2^(i * rootBitCount) (negacyclic weight).
+	/// </summary>
+	static void Decompose(const UInt32 *digitsPtr, const UInt32 length, const UInt32 partLength, const int logK,
+		const UInt32 ringLength, const UInt64 rootBitCount, UInt32 *data, UInt32 *buffer)
+	{
+		UInt32 partCount = 1U << logK;
+		UInt32 elementLength = ringLength + 1;
+		for (UInt32 i = 0; i < partCount; ++i)
+		{
+			UInt32 offset = i * partLength;
+			UInt32 count = offset >= length ? 0 : (length - offset < partLength ? length - offset : partLength);
+			DigitHelper::DigitsBlockCopy(digitsPtr + offset, buffer, count);
+			DigitHelper::SetBlockDigits(buffer + count, elementLength - count, 0U);
+			MultiplyByPow2(buffer, i * rootBitCount, ringLength, data + (size_t)i * elementLength);
+		} // end for
+	} // end function Decompose
+
+	/// <summary>
+	/// Unweights convolution items, divides them by K and sums them up modulo 2^(32 * n) + 1.
+	/// Items are negacyclic convolution ones, so they can be negative (they are less than half of the modulus by absolute value).
+	/// </summary>
+	static void Compose(UInt32 *data, const UInt32 partLength, const int logK, const UInt32 ringLength,
+		const UInt64 rootBitCount, const UInt32 n, UInt32 *result, const UInt32 resultLength)
+	{
+		UInt32 partCount = 1U << logK;
+		UInt32 elementLength = ringLength + 1;
+		UInt64 fullBitCount = 64ULL * ringLength; // 2^fullBitCount is 1
+
+		// Sum is kept as ring element which highest digit is signed, so it's the only big buffer here
+		PooledArray<UInt32> sum(n + 1);
+		PooledArray<UInt32> item(elementLength, false);
+		for (UInt32 i = 0; i < partCount; ++i)
+		{
+			UInt32 *element = data + (size_t)i * elementLength;
+			MultiplyByPow2(element, fullBitCount - logK - i * rootBitCount, ringLength, item.data());
+
+			bool isNegative = item[ringLength] != 0 || item[ringLength - 1] >= 0x80000000U;
+			if (isNegative)
+			{
+				Negate(item.data(), ringLength, item.data());
+			} // end if
+
+			UInt32 itemLength = DigitHelper::GetRealDigitsLength(item.data(), elementLength);
+			AddShifted(sum.data(), n, item.data(), itemLength, i * partLength, isNegative);
+		} // end for
+
+		Normalize(sum.data(), n);
+		DigitHelper::DigitsBlockCopy(sum.data(), result, resultLength);
+	} // end function Compose
+
+	/// <summary>
+	/// Performs forward transform "in place" (decimation in frequency, items are returned in bit-reversed order).
+	/// </summary>
+	/// <param name="data">K ring elements.</param>
+	/// <param name="logK">Log2 of elements count K.</param>
+	/// <param name="ringLength">Ring length.</param>
+	/// <param name="buffer">Buffer for one element.</param>
+	static void Transform(UInt32 *data, const int logK, const UInt32 ringLength, UInt32 *buffer)
+	{
+		UInt32 partCount = 1U << logK;
+		UInt32 elementLength = ringLength + 1;
+		for (UInt32 halfLength = partCount >> 1; halfLength > 0; halfLength >>= 1)
+		{
+			// Root of order 2 * halfLength
+			UInt64 stepBitCount = 32ULL * ringLength / halfLength;
+			for (UInt32 start = 0; start < partCount; start += 2 * halfLength)
+			{
+				for (UInt32 j = 0; j < halfLength; ++j)
+				{
+					UInt32 *left = data + (size_t)(start + j) * elementLength;
+					UInt32 *right = left + (size_t)halfLength * elementLength;
+					SubMod(left, right, ringLength, buffer);
+					AddMod(left, right, ringLength, left);
+					MultiplyByPow2(buffer, j * stepBitCount, ringLength, right);
+				} // end for
+			} // end for
+		} // end for
+	} // end function Transform
+
+	/// <summary>
+	/// Performs reverse transform "in place" (decimation in time, items are expected in bit-reversed order).
+	/// Result isn't divided by K.
+	/// </summary>
+	/// <param name="data">K ring elements.</param>
+	/// <param name="logK">Log2 of elements count K.</param>
+	/// <param name="ringLength">Ring length.</param>
+	/// <param name="buffer">Buffer for one element.</param>
+	static void ReverseTransform(UInt32 *data, const int logK, const UInt32 ringLength, UInt32 *buffer)
+	{
+		UInt32 partCount = 1U << logK;
+		UInt32 elementLength = ringLength + 1;
+		UInt64 fullBitCount = 64ULL * ringLength;
+		for (UInt32 halfLength = 1; halfLength < partCount; halfLength <<= 1)
+		{
+			UInt64 stepBitCount = 32ULL * ringLength / halfLength;
+			for (UInt32 start = 0; start < partCount; start += 2 * halfLength)
+			{
+				for (UInt32 j = 0; j < halfLength; ++j)
+				{
+					UInt32 *left = data + (size_t)(start + j) * elementLength;
+					UInt32 *right = left + (size_t)halfLength * elementLength;
+					MultiplyByPow2(right, (fullBitCount - j * stepBitCount) % fullBitCount, ringLength, buffer);
+					SubMod(left, buffer, ringLength, right);
+					AddMod(left, buffer, ringLength, left);
+				} // end for
+			} // end for
+		} // end for
+	} // end function ReverseTransform
+
+	//==================================================================
+	//  Arithmetic modulo 2^(32 * n) + 1
+	//==================================================================
+
+	/// <summary>
+	/// Adds two ring elements (result may be the same as any of them).
+	/// </summary>
+	static void AddMod(const UInt32 *a, const UInt32 *b, const UInt32 n, UInt32 *result)
+	{
+		UInt64 c = 0;
+		for (UInt32 i = 0; i <= n; ++i)
+		{
+			c += (UInt64)a[i] + b[i];
+			result[i] = (UInt32)c;
+			c >>= 32;
+		} // end for
+		Normalize(result, n);
+	} // end function AddMod
+
+	/// <summary>
+	/// Subtracts two ring elements (result may be the same as any of them).
+	/// </summary>
+	static void SubMod(const UInt32 *a, const UInt32 *b, const UInt32 n, UInt32 *result)
+	{
+		UInt64 borrow = 0;
+		for (UInt32 i = 0; i <= n; ++i)
+		{
+			UInt64 d = (UInt64)a[i] - b[i] - borrow;
+			result[i] = (UInt32)d;
+			borrow = d >> 63;
+		} // end for
+		Normalize(result, n);
+	} // end function SubMod
+
+	/// <summary>
+	/// Calculates a0 - a1 modulo 2^(32 * n) + 1 for two n-digit numbers.
+	/// </summary>
+	static void SubDigits(const UInt32 *a0, const UInt32 *a1, const UInt32 n, UInt32 *result)
+	{
+		UInt64 borrow = 0;
+		for (UInt32 i = 0; i < n; ++i)
+		{
+			UInt64 d = (UInt64)a0[i] - a1[i] - borrow;
+			result[i] = (UInt32)d;
+			borrow = d >> 63;
+		} // end for
+		result[n] = (UInt32)(0U - (UInt32)borrow);
+		Normalize(result, n);
+	} // end function SubDigits
+
+	/// <summary>
+	/// Normalizes element which highest digit is small signed value h: x + h * 2^(32 * n) = x - h.
+	/// </summary>
+	static void Normalize(UInt32 *x, const UInt32 n)
+	{
+		int high = (int)x[n];
+		x[n] = 0;
+		if (high > 0)
+		{
+			// If x < high then x - high + 2^(32 * n) is got, so 1 is added to it
+			if (SubDigit(x, n, (UInt32)high) && AddDigit(x, n, 1U))
+			{
+				x[n] = 1;
+			} // end if
+		} // end if
+		else if (high < 0)
+		{
+			// If there is carry then x + 2^(32 * n) is got, so 1 is subtracted from it
+			if (AddDigit(x, n, (UInt32)-high))
+			{
+				if (DigitHelper::GetRealDigitsLength(x, n) == 0)
+				{
+					x[n] = 1;
+				} // end if
+				else
+				{
+					SubDigit(x, n, 1U);
+				} // end else
+			} // end if
+		} // end else if
+	} // end function Normalize
+
+	/// <summary>
+	/// Adds (or subtracts) number multiplied by 2^(32 * offset) to the element which highest digit is signed.
+	/// Number digits which get over n are wrapped around with opposite sign since 2^(32 * n) is -1.
+	/// Element isn't normalized.
+	/// </summary>
+	static void AddShifted(UInt32 *x, const UInt32 n, const UInt32 *digitsPtr, const UInt32 length, const UInt32 offset, const bool subtract)
+	{
+		bool negate = subtract;
+		UInt32 start = offset;
+		for (UInt32 done = 0; done < length; )
+		{
+			UInt32 count = length - done < n - start ? length - done : n - start;
+			AddPart(x, n, start, digitsPtr + done, count, negate);
+			done += count;
+			start = 0;
+			negate = !negate;
+		} // end for
+	} // end function AddShifted
+
+	// Adds (or subtracts) count digits to the element starting from given digit; carry goes to signed highest digit.
+	static void AddPart(UInt32 *x, const UInt32 n, const UInt32 start, const UInt32 *digitsPtr, const UInt32 count, const bool subtract)
+	{
+		UInt64 c = 0;
+		UInt32 i = start;
+		if (subtract)
+		{
+			for (UInt32 j = 0; j < count; ++i, ++j)
+			{
+				UInt64 d = (UInt64)x[i] - digitsPtr[j] - c;
+				x[i] = (UInt32)d;
+				c = d >> 63;
+			} // end for
+			if (c != 0 && SubDigit(x + i, n - i, 1U))
+			{
+				--x[n];
+			} // end if
+		} // end if
+		else
+		{
+			for (UInt32 j = 0; j < count; ++i, ++j)
+			{
+				c += (UInt64)x[i] + digitsPtr[j];
+				x[i] = (UInt32)c;
+				c >>= 32;
+			} // end for
+			if (c != 0 && AddDigit(x + i, n - i, 1U))
+			{
+				++x[n];
+			} // end if
+		} // end else
+	} // end function AddPart
+
+	// Adds digit to n-digit number, returns carry.
+	static bool AddDigit(UInt32 *x, const UInt32 n, const UInt32 digit)
+	{
+		UInt64 c = digit;
+		for (UInt32 i = 0; c != 0 && i < n; ++i)
+		{
+			c += x[i];
+			x[i] = (UInt32)c;
+			c >>= 32;
+		} // end for
+		return c != 0;
+	} // end function AddDigit
+
+	// Subtracts digit from n-digit number, returns borrow.
+	static bool SubDigit(UInt32 *x, const UInt32 n, const UInt32 digit)
+	{
+		UInt64 borrow = digit;
+		for (UInt32 i = 0; borrow != 0 && i < n; ++i)
+		{
+			UInt64 d = (UInt64)x[i] - borrow;
+			x[i] = (UInt32)d;
+			borrow = d >> 63;
+		} // end for
+		return borrow != 0;
+	} // end function SubDigit
+
+	/// <summary>
+	/// Negates ring element: 2^(32 * n) + 1 - a (result may be the same as element).
+	/// </summary>
+	static void Negate(const UInt32 *a, const UInt32 n, UInt32 *result)
+	{
+		if (a[n] != 0)
+		{
+			DigitHelper::SetBlockDigits(result, n + 1, 0U);
+			result[0] = 1;
+			return;
+		} // end if
+		if (DigitHelper::GetRealDigitsLength(a, n) == 0)
+		{
+			DigitHelper::SetBlockDigits(result, n + 1, 0U);
+			return;
+		} // end if
+
+		// ~a + 2 == 2^(32 * n) + 1 - a
+		UInt64 c = 2;
+		for (UInt32 i = 0; i < n; ++i)
+		{
+			c += (UInt32)~a[i];
+			result[i] = (UInt32)c;
+			c >>= 32;
+		} // end for
+		result[n] = (UInt32)c;
+	} // end function Negate
+
+	/// <summary>
+	/// Multiplies ring element by 2^bitCount. Since 2^(32 * n) is -1 it's a cyclic shift with
+	/// negation of the digits moved around.
+	/// </summary>
+	/// <param name="a">Element (mustn't overlap with result).</param>
+	/// <param name="bitCount">Power of 2 (less than 64 * n).</param>
+	/// <param name="n">Ring length.</param>
+	/// <param name="result">Resulting element.</param>
+	static void MultiplyByPow2(const UInt32 *a, const UInt64 vbitCount, const UInt32 n, UInt32 *result)
+	{
+		UInt64 bitCount = vbitCount;
+		bool negate = bitCount >= 32ULL * n;
+		if (negate)
+		{
+			bitCount -= 32ULL * n;
+		} // end if
+
+		UInt32 digitShift = (UInt32)(bitCount >> 5);
+		int shift = (int)(bitCount & 31);
+
+		// a * 2^bitCount = low + high * 2^(32 * n) = low - high, where low and high are the parts of shifted digits
+		UInt64 borrow = 0;
+		for (UInt32 i = 0; i <= n; ++i)
+		{
+			UInt32 low = i < n ? GetShiftedDigit(a, n, i, digitShift, shift) : 0;
+			UInt32 high = GetShiftedDigit(a, n, n + i, digitShift, shift);
+			UInt64 d = (UInt64)low - high - borrow;
+			result[i] = (UInt32)d;
+			borrow = d >> 63;
+		} // end for
+		Normalize(result, n);
+
+		if (negate)
+		{
+			Negate(result, n, result);
+		} // end if
+	} // end function MultiplyByPow2
+
+	// Returns digit with given index of element (n + 1 digits) shifted left.
+	static UInt32 GetShiftedDigit(const UInt32 *a, const UInt32 n, const UInt32 index, const UInt32 digitShift, const int shift)
+	{
+		if (index < digitShift) return 0;
+
+		UInt32 source = index - digitShift;
+		UInt32 digit = source <= n ? a[source] << shift : 0;
+		if (shift != 0 && source > 0 && source - 1 <= n)
+		{
+			digit |= a[source - 1] >> (32 - shift);
+		} // end if
+		return digit;
+	} // end function GetShiftedDigit
+
+}; // end class SchonhageStrassenMultiplier
+
+#endif // !SCHONHAGESTRASSENMULTIPLIER_H
@@ -0,0 +1,463 @@
+#pragma once
+
+#ifndef TOOMCOOKMULTIPLIER_H
+#define TOOMCOOKMULTIPLIER_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "IMultiplier.h"
+#include "MultiplierBase.h"
+#include "../IntXView.h"
+#include "../Utils/Constants.h"
+#include "../OpHelpers/DigitHelper.h"
+#include "../OpHelpers/DigitOpHelper.h"
+
+#include <vector>
+
+using namespace std;
+
+// Multiplies using Toom-Cook algorithm: each big integer is cut into up to <see cref="_partCount" /> parts
+// (Toom-3 or Toom-4), parts are treated as polynomial coefficients which are evaluated in several points,
+// multiplied pointwise and interpolated back.
+// Unbalanced big integers are cut into different count of parts of the same length (Toom-3.2, Toom-4.3, Toom-4.2),
+// and if the shorter one is too short even for that, the longer one is multiplied piece by piece.
+// Time estimate is O(n ^ 1.465) for Toom-3 and O(n ^ 1.404) for Toom-4.
+class ToomCookMultiplier : public MultiplierBase
+{
+public:
+
+	/// <summary>
+	/// Creates new <see cref="ToomCookMultiplier" /> instance.
+	/// </summary>
+	/// <param name="partCount">Count of parts big integers are cut into (3 or 4).</param>
+	/// <param name="lengthLowerBound">Length from which this multiplier is used (and recursion threshold).</param>
+	/// <param name="lowerMultiplier">Multiplier used for shorter big integers.</param>
+	ToomCookMultiplier(const UInt32 partCount, const UInt32 lengthLowerBound, IMultiplier &lowerMultiplier)
+	{
+		_partCount = partCount;
+		_lengthLowerBound = lengthLowerBound;
+		_lowerMultiplier = &lowerMultiplier;
+
+		// Interpolation for each count of points (from 3 for Toom-2 to 2 * partCount - 1)
+		for (UInt32 pointCount = 3; pointCount <= 2 * partCount - 1; ++pointCount)
+		{
+			_interpolations.push_back(Interpolation(pointCount - 2));
+		} // end for
+	} // end .cctr
+
+	/// <summary>
+	/// Multiplies two big integers using pointers.
+	/// </summary>
+	/// <param name="digitsPtr1">First big integer digits.</param>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="digitsPtr2">Second big integer digits.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer length.</returns>
+	virtual UInt32 Multiply(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use lower multiplier instead
+		if (length1 < _lengthLowerBound || length2 < _lengthLowerBound)
+		{
+			return _lowerMultiplier->Multiply(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+		} // end if
+
+		// The same digits are squared
+		if (digitsPtr1 == digitsPtr2 && length1 == length2)
+		{
+			return Sqr(digitsPtr1, length1, digitsResPtr);
+		} // end if
+
+		// First must be bigger
+		if (length1 < length2)
+		{
+			return Multiply(digitsPtr2, length2, digitsPtr1, length1, digitsResPtr);
+		} // end if
+
+		UInt32 newLength = length1 + length2;
+		DigitHelper::SetBlockDigits(digitsResPtr, newLength, 0U);
+
+		UInt32 partLength = (length1 + _partCount - 1) / _partCount;
+		if (length2 <= partLength)
+		{
+			MultiplyByPieces(digitsPtr1, length1, digitsPtr2, length2, digitsResPtr);
+		} // end if
+		else
+		{
+			MultiplyParts(digitsPtr1, length1, digitsPtr2, length2, partLength, digitsResPtr);
+		} // end else
+
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function Multiply
+
+	/// <summary>
+	/// Squares big integer using pointers: polynomial is evaluated once and its values are squared.
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits.</param>
+	/// <returns>Resulting big integer length.</returns>
+	virtual UInt32 Sqr(const UInt32 *digitsPtr, const UInt32 length, UInt32 *digitsResPtr)
+	{
+		// Check length - maybe use lower multiplier instead
+		if (length < _lengthLowerBound)
+		{
+			return _lowerMultiplier->Sqr(digitsPtr, length, digitsResPtr);
+		} // end if
+
+		UInt32 newLength = 2 * length;
+		DigitHelper::SetBlockDigits(digitsResPtr, newLength, 0U);
+
+		UInt32 partLength = (length + _partCount - 1) / _partCount;
+		MultiplyParts(digitsPtr, length, digitsPtr, length, partLength, digitsResPtr);
+
+		return digitsResPtr[newLength - 1] == 0 ? --newLength : newLength;
+	} // end function Sqr
+
+private:
+
+	//==================================================================
+	//  Interpolation
+	//==================================================================
+
+	// Evaluation points besides 0 and infinity (in order of use).
+	static int GetPoint(const UInt32 index)
+	{
+		static const int points[] = { 1, -1, 2, -2, 3 };
+		return points[index];
+	} // end function GetPoint
+
+	/// <summary>
+	/// Inverse Vandermonde matrix for inner evaluation points (see <see cref="GetPoint" />) stored as
+	/// integer matrix and common denominator. Product polynomial coefficients 1..count are got from its
+	/// values in inner points after known coefficients 0 and count + 1 are excluded.
+	/// </summary>
+	struct Interpolation
+	{
+		UInt32 count; // count of inner points
+		vector<long long> matrix; // count x count integer matrix
+		long long denominator; // common denominator of matrix items
+
+		explicit Interpolation(const UInt32 vcount) : count(vcount), matrix(vcount * vcount), denominator(1)
+		{
+			// Gauss-Jordan elimination over fractions (numerators / denominators)
+			UInt32 width = 2 * count;
+			vector<long long> numerators(count * width, 0), denominators(count * width, 1);
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				long long power = 1;
+				for (UInt32 j = 0; j < count; ++j, power *= GetPoint(i))
+				{
+					numerators[i * width + j] = power;
+				} // end for
+				numerators[i * width + count + i] = 1;
+			} // end for
+
+			for (UInt32 column = 0; column < count; ++column)
+			{
+				// Find row with non-zero pivot
+				UInt32 pivot = column;
+				while (numerators[pivot * width + column] == 0) ++pivot;
+				for (UInt32 j = 0; j < width; ++j)
+				{
+					swap(numerators[pivot * width + j], numerators[column * width + j]);
+					swap(denominators[pivot * width + j], denominators[column * width + j]);
+				} // end for
+
+				// Normalize pivot row
+				long long pivotNumerator = numerators[column * width + column], pivotDenominator = denominators[column * width + column];
+				for (UInt32 j = 0; j < width; ++j)
+				{
+					SetFraction(numerators[column * width + j], denominators[column * width + j],
+						numerators[column * width + j] * pivotDenominator, denominators[column * width + j] * pivotNumerator);
+				} // end for
+
+				// Eliminate column from other rows
+				for (UInt32 i = 0; i < count; ++i)
+				{
+					long long factorNumerator = numerators[i * width + column], factorDenominator = denominators[i * width + column];
+					if (i == column || factorNumerator == 0) continue;
+
+					for (UInt32 j = 0; j < width; ++j)
+					{
+						long long n = numerators[column * width + j] * factorNumerator, d = denominators[column * width + j] * factorDenominator;
+						SetFraction(numerators[i * width + j], denominators[i * width + j],
+							numerators[i * width + j] * d - n * denominators[i * width + j], denominators[i * width + j] * d);
+					} // end for
+				} // end for
+			} // end for
+
+			// Bring inverse matrix to common denominator
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				for (UInt32 j = 0; j < count; ++j)
+				{
+					long long d = denominators[i * width + count + j];
+					denominator = denominator / Gcd(denominator, d) * d;
+				} // end for
+			} // end for
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				for (UInt32 j = 0; j < count; ++j)
+				{
+					matrix[i * count + j] = numerators[i * width + count + j] * (denominator / denominators[i * width + count + j]);
+				} // end for
+			} // end for
+		} // end constructor
+
+		static long long Gcd(long long a, long long b)
+		{
+			if (a < 0) a = -a;
+			if (b < 0) b = -b;
+			while (b != 0)
+			{
+				long long t = a % b;
+				a = b;
+				b = t;
+			} // end while
+			return a;
+		} // end function Gcd
+
+		// Stores reduced fraction with positive denominator.
+		static void SetFraction(long long &numerator, long long &denominator, long long n, long long d)
+		{
+			long long gcd = Gcd(n, d);
+			if (gcd == 0) gcd = 1;
+			if (d < 0) gcd = -gcd;
+			numerator = n / gcd;
+			denominator = d / gcd;
+		} // end function SetFraction
+	}; // end struct Interpolation
+
+	//==================================================================
+	//  Multiplication
+	//==================================================================
+
+	/// <summary>
+	/// Multiplies big integers cut into parts of <paramref name="partLength" /> digits.
+	/// The same digits are squared. Resulting digits must be zeroed.
+	/// </summary>
+	void MultiplyParts(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2,
+		const UInt32 partLength, UInt32 *digitsResPtr)
+	{
+		bool square = digitsPtr1 == digitsPtr2 && length1 == length2;
+		vector<IntXView> parts1, parts2;
+		CutIntoParts(digitsPtr1, length1, partLength, parts1);
+		if (!square)
+		{
+			CutIntoParts(digitsPtr2, length2, partLength, parts2);
+		} // end if
+
+		// Product polynomial has pointCount coefficients: two of them are products of the outer parts
+		UInt32 pointCount = (UInt32)(square ? 2 * parts1.size() - 1 : parts1.size() + parts2.size() - 1);
+		IntX lowest = square ? MultiplierBase::Sqr(parts1.front()) : MultiplierBase::Multiply(parts1.front(), parts2.front());
+		IntX highest = square ? MultiplierBase::Sqr(parts1.back()) : MultiplierBase::Multiply(parts1.back(), parts2.back());
+
+		// Product values in inner points with outer coefficients excluded (divided by the point)
+		const Interpolation &interpolation = _interpolations[pointCount - 3];
+		vector<IntX> values(interpolation.count), values2(square ? 0 : interpolation.count);
+		EvaluatePoints(parts1, values);
+		if (!square)
+		{
+			EvaluatePoints(parts2, values2);
+		} // end if
+
+		IntX scaled; // buffer for multiplication by small factors
+		for (UInt32 i = 0; i < interpolation.count; ++i)
+		{
+			int point = GetPoint(i);
+			long long highestFactor = 1;
+			for (UInt32 j = 0; j < pointCount - 1; ++j)
+			{
+				highestFactor *= point;
+			} // end for
+
+			values[i] = square ? MultiplierBase::Sqr(values[i]) : MultiplierBase::Multiply(values[i], values2[i]);
+			values[i] -= lowest;
+			AddMultiplied(values[i], highest, -highestFactor, scaled);
+			DivideExact(values[i], point);
+		} // end for
+
+		AddCoefficient(lowest, 0, length1 + length2, digitsResPtr);
+		AddCoefficient(highest, (pointCount - 1) * partLength, length1 + length2, digitsResPtr);
+
+		for (UInt32 i = 0; i < interpolation.count; ++i)
+		{
+			IntX coefficient;
+			for (UInt32 j = 0; j < interpolation.count; ++j)
+			{
+				long long factor = interpolation.matrix[i * interpolation.count + j];
+				if (factor != 0)
+				{
+					AddMultiplied(coefficient, values[j], factor, scaled);
+				} // end if
+			} // end for
+			DivideExact(coefficient, interpolation.denominator);
+
+			AddCoefficient(coefficient, (i + 1) * partLength, length1 + length2, digitsResPtr);
+		} // end for
+	} // end function MultiplyParts
+
+	/// <summary>
+	/// Multiplies long big integer by a much shorter one: longer one is cut into pieces of the shorter
+	/// one length and their products are accumulated. Resulting digits must be zeroed.
+	/// </summary>
+	void MultiplyByPieces(const UInt32 *digitsPtr1, const UInt32 length1, const UInt32 *digitsPtr2, const UInt32 length2, UInt32 *digitsResPtr)
+	{
+		DigitsVector product(2 * length2);
+		for (UInt32 offset = 0; offset < length1; offset += length2)
+		{
+			UInt32 pieceLength = length1 - offset < length2 ? length1 - offset : length2;
+			UInt32 pieceDigitsLength = DigitHelper::GetRealDigitsLength(digitsPtr1 + offset, pieceLength);
+			if (pieceDigitsLength == 0) continue;
+
+			DigitHelper::SetBlockDigits(product.data(), pieceLength + length2, 0U);
+			UInt32 productLength = Multiply(digitsPtr1 + offset, pieceLength, digitsPtr2, length2, product.data());
+			// Only lower length2 digits are already filled here (by the previous product)
+			productLength = DigitHelper::GetRealDigitsLength(product.data(), productLength);
+			DigitOpHelper::Add(product.data(), productLength, digitsResPtr + offset, length2, digitsResPtr + offset);
+		} // end for
+	} // end function MultiplyByPieces
+
+	// Cuts digits into parts (views) of given length (the last one may be shorter).
+	static void CutIntoParts(const UInt32 *digitsPtr, const UInt32 length, const UInt32 partLength, vector<IntXView> &parts)
+	{
+		for (UInt32 offset = 0; offset < length; offset += partLength)
+		{
+			parts.push_back(IntXView(digitsPtr + offset, length - offset < partLength ? length - offset : partLength, false));
+		} // end for
+	} // end function CutIntoParts
+
+	/// <summary>
+	/// Evaluates polynomial with given coefficients in inner points (see <see cref="GetPoint" />).
+	/// Values in points x and -x are got from the same sums of even and odd terms.
+	/// </summary>
+	/// <param name="parts">Polynomial coefficients.</param>
+	/// <param name="values">Values (one for each inner point in use).</param>
+	static void EvaluatePoints(const vector<IntXView> &parts, vector<IntX> &values)
+	{
+		for (UInt32 i = 0; i < values.size(); ++i)
+		{
+			int point = GetPoint(i);
+			if (i + 1 < values.size() && GetPoint(i + 1) == -point)
+			{
+				IntX odd = EvaluateTerms(parts, 1, point);
+				values[i] = EvaluateTerms(parts, 0, point);
+				values[i + 1] = values[i];
+				values[i] += odd;
+				values[i + 1] -= odd;
+				++i;
+			} // end if
+			else
+			{
+				values[i] = EvaluateTerms(parts, 0, point);
+				values[i] += EvaluateTerms(parts, 1, point);
+			} // end else
+		} // end for
+	} // end function EvaluatePoints
+
+	/// <summary>
+	/// Sums polynomial terms with even or odd indexes in given point (Horner's scheme in squared point).
+	/// </summary>
+	/// <param name="parts">Polynomial coefficients.</param>
+	/// <param name="first">Index of the first term (0 for even terms, 1 for odd ones).</param>
+	/// <param name="point">Point.</param>
+	static IntX EvaluateTerms(const vector<IntXView> &parts, const size_t first, const int point)
+	{
+		if (first >= parts.size()) return IntX();
+
+		size_t last = first + (parts.size() - 1 - first) / 2 * 2;
+		IntX value = parts[last];
+		for (size_t i = last; i > first; i -= 2)
+		{
+			MultiplyBySmall(value, point * point);
+			value += parts[i - 2];
+		} // end for
+		if (first == 1)
+		{
+			MultiplyBySmall(value, point);
+		} // end if
+		return value;
+	} // end function EvaluateTerms
+
+	/// <summary>
+	/// Multiplies big integer by small factor in place.
+	/// Unlike operator *= it never uses per-thread scratch big integer which may be busy
+	/// (this multiplier can be called by <see cref="OpHelper::MultiplyModulo" /> divider).
+	/// </summary>
+	static void MultiplyBySmall(IntX &value, const int factor)
+	{
+		if (value.length == 0) return;
+
+		if (value.digits.size() <= value.length)
+		{
+			value.digits.resize(value.length + 1);
+		} // end if
+		value.length = DigitOpHelper::Multiply(value.digits.data(), value.length, (UInt32)(factor < 0 ? -factor : factor), value.digits.data());
+		value.negative ^= factor < 0;
+	} // end function MultiplyBySmall
+
+	/// <summary>
+	/// Adds big integer multiplied by small factor to another one (in place).
+	/// </summary>
+	/// <param name="value">Big integer to add to.</param>
+	/// <param name="addend">Big integer to multiply and add.</param>
+	/// <param name="factor">Factor (its absolute value must fit one digit).</param>
+	/// <param name="scaled">Buffer for product (kept between calls to avoid allocations).</param>
+	static void AddMultiplied(IntX &value, const IntX &addend, const long long factor, IntX &scaled)
+	{
+		if (factor == 1)
+		{
+			value += addend;
+			return;
+		} // end if
+		if (factor == -1)
+		{
+			value -= addend;
+			return;
+		} // end if
+
+		UInt32 scaledLength = addend.length + 1;
+		if (scaled.digits.size() < scaledLength)
+		{
+			scaled.digits.resize(scaledLength);
+		} // end if
+		scaled.length = addend.length == 0 ? 0 :
+			DigitOpHelper::Multiply(addend.digits.data(), addend.length, (UInt32)(factor < 0 ? -factor : factor), scaled.digits.data());
+		scaled.negative = scaled.length != 0 && (addend.negative ^ (factor < 0));
+		value += scaled;
+	} // end function AddMultiplied
+
+	// Divides big integer by small one in place (remainder must be zero).
+	static void DivideExact(IntX &value, const long long divisor)
+	{
+		if (divisor < 0 && value.length != 0)
+		{
+			value.negative = !value.negative;
+		} // end if
+		value.length = DigitOpHelper::DivExact(value.digits.data(), value.length, (UInt32)(divisor < 0 ? -divisor : divisor));
+		if (value.length == 0)
+		{
+			value.negative = false;
+		} // end if
+	} // end function DivideExact
+
+	// Adds product polynomial coefficient (non-negative) to resulting digits at given offset.
+	static void AddCoefficient(const IntX &coefficient, const UInt32 offset, const UInt32 resultLength, UInt32 *digitsResPtr)
+	{
+		IntXView view(coefficient);
+		if (view.getLength() == 0) return;
+
+		DigitOpHelper::Add(digitsResPtr + offset, resultLength - offset, view.getDigits(), view.getLength(), digitsResPtr + offset);
+	} // end function AddCoefficient
+
+	UInt32 _partCount; // count of parts big integers are cut into
+	UInt32 _lengthLowerBound; // length from which this multiplier is used
+	IMultiplier *_lowerMultiplier; // multiplier for shorter big integers
+	vector<Interpolation> _interpolations; // interpolation for each count of points starting from 3
+
+}; // end class ToomCookMultiplier
+
+#endif // !TOOMCOOKMULTIPLIER_H
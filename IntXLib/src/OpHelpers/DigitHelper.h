@@ -8,6 +8,17 @@ typedef unsigned long long UInt64;
 typedef unsigned int UInt32;
 
 #include "../Utils/Constants.h"
+#include <cstring>
+
+// 64-bit kernels: hot loops (adding, subtracting, multiplying) process digits in pairs
+// as 64-bit words with 128-bit intermediate results. Digits are still stored as UInt32,
+// so public API doesn't depend on this setting. Enabled by default on little-endian targets
+// where compiler supports unsigned __int128; define INTX_NO_64BIT_KERNELS to use 32-bit kernels only.
+#if !defined(INTX_NO_64BIT_KERNELS) && defined(__SIZEOF_INT128__) && \
+	defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define INTX_64BIT_KERNELS
+__extension__ typedef unsigned __int128 UInt128; // __extension__ keeps -pedantic quiet
+#endif
 
 
 class DigitHelper
@@ -89,6 +100,30 @@ public:
 		for (UInt32* blockFromEnd = blockFrom + count; blockFrom < blockFromEnd; *blockTo++ = *blockFrom++);
 	} // end function DigitsBlockCopy
 
+#ifdef INTX_64BIT_KERNELS
+	/// <summary>
+	/// Reads two digits starting from given one as single 64-bit word.
+	/// </summary>
+	/// <param name="digits">Pointer to lower digit.</param>
+	/// <returns>64-bit word.</returns>
+	static UInt64 Load64(const UInt32* digits)
+	{
+		UInt64 value;
+		memcpy(&value, digits, sizeof(value));
+		return value;
+	} // end function Load64
+
+	/// <summary>
+	/// Writes 64-bit word into two digits starting from given one.
+	/// </summary>
+	/// <param name="digits">Pointer to lower digit.</param>
+	/// <param name="value">64-bit word.</param>
+	static void Store64(UInt32* digits, const UInt64 value)
+	{
+		memcpy(digits, &value, sizeof(value));
+	} // end function Store64
+#endif // INTX_64BIT_KERNELS
+
 }; // end class DigitHelper
 
 #endif //!DIGITHELPER_H
\ No newline at end of file
@@ -43,8 +43,20 @@ public:
 			digitsPtr2 = ptrTemp;
 		} // end if
 
+		UInt32 i = 0;
+
+#ifdef INTX_64BIT_KERNELS
+		// Perform digits adding by pairs
+		for (; i + 1 < length2; i += 2)
+		{
+			UInt128 sum = (UInt128)DigitHelper::Load64(digitsPtr1 + i) + DigitHelper::Load64(digitsPtr2 + i) + c;
+			DigitHelper::Store64(digitsResPtr + i, (UInt64)sum);
+			c = (UInt64)(sum >> 64);
+		} // end for
+#endif // INTX_64BIT_KERNELS
+
 		// Perform digits adding
-		for (UInt32 i = 0; i < length2; ++i)
+		for (; i < length2; ++i)
 		{
 			c += (UInt64)(digitsPtr1[i]) + (UInt64)digitsPtr2[i];
 			digitsResPtr[i] = (UInt32)c;
@@ -52,7 +64,7 @@ public:
 		} // end for
 
 		// Perform digits + carry moving
-		for (UInt32 i = length2; i < length1; ++i)
+		for (; i < length1; ++i)
 		{
 			c += digitsPtr1[i];
 			digitsResPtr[i] = (UInt32)c;
@@ -84,8 +96,20 @@ public:
 		UInt32 length2 = vlength2;
 		UInt64 c = 0;
 
+		UInt32 i = 0;
+
+#ifdef INTX_64BIT_KERNELS
+		// Perform digits subtraction by pairs
+		for (; i + 1 < length2; i += 2)
+		{
+			UInt128 diff = (UInt128)DigitHelper::Load64(digitsPtr1 + i) - DigitHelper::Load64(digitsPtr2 + i) - c;
+			DigitHelper::Store64(digitsResPtr + i, (UInt64)diff);
+			c = (UInt64)(diff >> 127);
+		} // end for
+#endif // INTX_64BIT_KERNELS
+
 		// Perform digits subtraction
-		for (UInt32 i = 0; i < length2; ++i)
+		for (; i < length2; ++i)
 		{
 			c = (UInt64)digitsPtr1[i] - (UInt64)digitsPtr2[i] - c;
 			digitsResPtr[i] = (UInt32)c;
@@ -93,7 +117,7 @@ public:
 		} // end for
 
 		// Perform digits + carry moving
-		for (UInt32 i = length2; i < length1; ++i)
+		for (; i < length1; ++i)
 		{
 			c = digitsPtr1[i] - c;
 			digitsResPtr[i] = (UInt32)c;
@@ -103,6 +127,47 @@ public:
 		return DigitHelper::GetRealDigitsLength(digitsResPtr, length1);
 	} // end function Sub
 
+	/// <summary>
+	/// Multiplies big integer by one digit using pointers.
+	/// Resulting digits may point to the same memory as the source ones.
+	/// </summary>
+	/// <param name="digitsPtr1">Big integer digits.</param>
+	/// <param name="length1">Big integer length.</param>
+	/// <param name="int2">Digit to multiply by.</param>
+	/// <param name="digitsResPtr">Resulting big integer digits (must have room for <paramref name="length1" /> + 1 digits).</param>
+	/// <returns>Resulting big integer length.</returns>
+	static UInt32 Multiply(const UInt32* digitsPtr1, const UInt32 length1,
+		const UInt32 int2, UInt32* digitsResPtr)
+	{
+		UInt64 c = 0;
+		UInt32 i = 0;
+
+#ifdef INTX_64BIT_KERNELS
+		for (; i + 1 < length1; i += 2)
+		{
+			UInt128 product = (UInt128)DigitHelper::Load64(digitsPtr1 + i) * int2 + c;
+			DigitHelper::Store64(digitsResPtr + i, (UInt64)product);
+			c = (UInt64)(product >> 64);
+		} // end for
+#endif // INTX_64BIT_KERNELS
+
+		for (; i < length1; ++i)
+		{
+			c += (UInt64)digitsPtr1[i] * int2;
+			digitsResPtr[i] = (UInt32)c;
+			c >>= 32;
+		} // end for
+
+		// Account last carry
+		if (c != 0)
+		{
+			digitsResPtr[length1] = (UInt32)c;
+			return length1 + 1;
+		} // end if
+
+		return DigitHelper::GetRealDigitsLength(digitsResPtr, length1);
+	} // end function Multiply
+
 	/// <summary>
 	/// Divides one big integer represented by it's digits on another one big ingeter.
 	/// Reminder is always filled (but not the result).
@@ -154,6 +219,58 @@ public:
 
 		return (UInt32)c;
 	} // end function Mod
+
+	/// <summary>
+	/// Divides big integer by digit in place when it's known that remainder is zero.
+	/// Uses multiplication by inverse of divisor modulo 2^32 instead of division (Jebelean's method).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits (divisible by <paramref name="int2" />).</param>
+	/// <param name="length">Big integer length.</param>
+	/// <param name="int2">Divisor (not zero).</param>
+	/// <returns>Resulting big integer length.</returns>
+	static UInt32 DivExact(UInt32* digitsPtr, const UInt32 length, const UInt32 int2)
+	{
+		if (length == 0) return 0;
+
+		// Power of 2 part of divisor is shifted out
+		UInt32 divisor = int2;
+		UInt32 shift = 0;
+		while ((divisor & 1U) == 0)
+		{
+			divisor >>= 1;
+			++shift;
+		} // end while
+		if (shift != 0)
+		{
+			for (UInt32 i = 0; i + 1 < length; ++i)
+			{
+				digitsPtr[i] = (digitsPtr[i] >> shift) | (digitsPtr[i + 1] << (Constants::DigitBitCount - shift));
+			} // end for
+			digitsPtr[length - 1] >>= shift;
+		} // end if
+
+		if (divisor != 1)
+		{
+			// Inverse modulo 2^32 by Newton's iterations (each one doubles correct bits count)
+			UInt32 inverse = divisor;
+			for (int i = 0; i < 4; ++i)
+			{
+				inverse *= 2U - divisor * inverse;
+			} // end for
+
+			UInt32 borrow = 0;
+			for (UInt32 i = 0; i < length; ++i)
+			{
+				UInt32 digit = digitsPtr[i];
+				UInt32 nextBorrow = digit < borrow ? 1U : 0U;
+				UInt32 quotient = (digit - borrow) * inverse;
+				digitsPtr[i] = quotient;
+				borrow = (UInt32)(((UInt64)quotient * divisor) >> Constants::DigitBitCount) + nextBorrow;
+			} // end for
+		} // end if
+
+		return DigitHelper::GetRealDigitsLength(digitsPtr, length);
+	} // end function DivExact
 		
 	/// <summary>
 	/// Compares 2 <see cref="IntX" /> objects represented by pointers only (not taking sign into account).
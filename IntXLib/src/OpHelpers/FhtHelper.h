@@ -9,9 +9,27 @@ typedef unsigned int UInt32;
 
 #include <math.h>
 #include <vector>
+#include <type_traits>
 #include "../Bits.h"
 #include "DigitHelper.h"
 #include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
+#include "../Utils/ThreadPool.h"
+
+// SIMD kernels: "butterfly" loops of FHT and multiplication of FHT results process 4 doubles at once
+// with AVX2 and FMA instructions. They are compiled on x86-64 targets by GCC, Clang and MSVC and used
+// only if CPU supports these instructions (checked once at run time), otherwise scalar code is used;
+// define INTX_NO_FHT_SIMD to use scalar code only.
+#if !defined(INTX_NO_FHT_SIMD) && (defined(__GNUC__) && defined(__x86_64__) || defined(_MSC_VER) && defined(_M_X64))
+#define INTX_FHT_SIMD
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define INTX_TARGET_AVX2
+#else
+#define INTX_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#endif
 
 using namespace std;
 
@@ -19,106 +37,142 @@ class FhtHelper
 {
 private:
 	
-	// Trigonometry values.
-	struct TrigValues
-	{
-		// Sin value from <see cref="SineTable" />.
-		double TableSin;
-
-		// Cos value from <see cref="SineTable" />.
-		double TableCos;
-
-		// Sin value.
-		double Sin;
-
-		// Cos value.
-		double Cos;
-	}; // end struct
-
-	//static TrigValues trigValues;
-
-	// double[] data base
-	static const int DoubleDataBytes = 1;
-	static const int DoubleDataLengthShift; // = 2 - (DoubleDataBytes >> 1);
-	static const int DoubleDataDigitShift; // = DoubleDataBytes << 3;
-	static const long long DoubleDataBaseInt; // = 1L << DoubleDataDigitShift;
-	static const double DoubleDataBase; // = DoubleDataBaseInt;
-	static const double DoubleDataBaseDiv2; // = DoubleDataBase / 2.0;
+	// double[] data base: count of bits stored in each double depends on transform length
+	// (see <see cref="GetMaxDoubleDataBits" />)
+	static const int MinDoubleDataBits = 1;
+	static const int MaxDoubleDataBits = 16;
 
 	// SQRT(2) and SQRT(2) / 2
 	static const double Sqrt2;
 	static const double Sqrt2Div2;
 
-	// SIN() table
-	static vector<double> SineTable;
-	static bool isSineTableInitialized;
+	// Trigonometry values (cos and sin) of FHT "butterflies" for each log2(processing slice length), see <see cref="GetTwiddle" />;
+	// they are calculated once and shared by all threads
+	static const vector<vector<double> > TwiddleTables;
+
+#ifdef INTX_FHT_SIMD
+	// True if CPU supports instructions used by SIMD kernels
+	static const bool isSimdSupported;
+#endif
 
 public:
-	// .cctor
-	static void Init()
-	{
-		// Initialize SinTable
-		FillSineTable(SineTable);
-	} // end .cctor
+	// Maximal rounding error of real digits (see <see cref="ConvertDoubleToDigits" />) for which
+	// FHT multiplication result is still trusted
+	static const double MaxRoundingError;
 
 	/// <summary>
 	/// Converts <see cref="IntX" /> digits into real representation (used in FHT).
 	/// </summary>
 	/// <param name="digitsPtr">Big integer digits.</param>
 	/// <param name="length"><paramref name="digitsPtr" /> length.</param>
-	/// <param name="newLength">Multiplication result length (must be pow of 2).</param>
-	/// <returns>Double array.</returns>
-	static vector<double> ConvertDigitsToDouble(const UInt32 *digitsPtr, const UInt32 length, const UInt32 vNewLength)
+	/// <param name="newLength">Multiplication result length.</param>
+	/// <returns>Double array (taken from pool).</returns>
+	static PooledArray<double> ConvertDigitsToDouble(const UInt32 *digitsPtr, const UInt32 length, const UInt32 vNewLength)
+	{
+		PooledArray<double> data(GetDoubleDataLength(vNewLength), false);
+		ConvertDigitsToDouble(digitsPtr, length, data.data(), data.size(), GetDoubleDataBits(vNewLength));
+		return data;
+	} // end function ConvertDigitsToDouble
+
+	/// <summary>
+	/// Returns length of real representation of multiplication result (used in FHT).
+	/// </summary>
+	/// <param name="newLength">Multiplication result length.</param>
+	/// <returns>Double array length.</returns>
+	static UInt32 GetDoubleDataLength(const UInt32 newLength)
 	{
-		UInt32 newLength = vNewLength;
+		// It's the shortest pow of 2 which can hold all result bits
+		// (each double keeps less of them for longer transforms)
+		UInt64 bitCount = (UInt64)newLength << 5;
+		int lengthLog2 = Bits::CeilLog2((UInt32)((bitCount + MaxDoubleDataBits - 1) / MaxDoubleDataBits));
+		if (lengthLog2 < 3)
+		{
+			lengthLog2 = 3;
+		} // end if
+		while (((UInt64)GetMaxDoubleDataBits(lengthLog2) << lengthLog2) < bitCount)
+		{
+			++lengthLog2;
+		} // end while
+		return 1U << lengthLog2;
+	} // end function GetDoubleDataLength
 
-		// Maybe fix newLength (make it the nearest bigger pow of 2)
-		newLength = 1U << Bits::CeilLog2(newLength);
+	/// <summary>
+	/// Returns count of bits stored in each double of real representation of multiplication result (used in FHT).
+	/// The least count which fits into <see cref="GetDoubleDataLength" /> doubles is taken for better accuracy.
+	/// </summary>
+	/// <param name="newLength">Multiplication result length.</param>
+	/// <returns>Count of bits per double.</returns>
+	static int GetDoubleDataBits(const UInt32 newLength)
+	{
+		UInt64 bitCount = (UInt64)newLength << 5;
+		UInt32 length = GetDoubleDataLength(newLength);
+		return (int)((bitCount + length - 1) / length);
+	} // end function GetDoubleDataBits
 
-		// For better FHT accuracy we will choose length smaller then dwords.
-		// So new length must be modified accordingly
-		newLength <<= DoubleDataLengthShift;
-		vector<double> data(newLength);
+	/// <summary>
+	/// Returns parameters of cyclic FHT multiplication: it takes half of usual transform (see <see cref="GetDoubleDataLength" />)
+	/// and gives result modulo 2^(32 * cyclicLength) - 1, i.e. its upper digits are added to the lower ones.
+	/// Each double keeps maximal count of bits for usual transform, so items of both transforms are equally big.
+	/// </summary>
+	/// <param name="newLength">Multiplication result length.</param>
+	/// <param name="dataLength">Resulting double array length.</param>
+	/// <param name="bits">Resulting count of bits per double.</param>
+	/// <returns>Cyclic length (count of digits kept by double array).</returns>
+	static UInt32 GetCyclicDigitsLength(const UInt32 newLength, UInt32 &dataLength, int &bits)
+	{
+		UInt32 length = GetDoubleDataLength(newLength);
+		bits = GetMaxDoubleDataBits(Bits::Msb(length));
+		dataLength = length >> 1;
+		return (UInt32)(((UInt64)dataLength * bits) >> 5);
+	} // end function GetCyclicDigitsLength
 
-		// Run in unsafe context
-		double* slice = &data[0];
-		
+	/// <summary>
+	/// Converts <see cref="IntX" /> digits into existing real representation (used in FHT).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length"><paramref name="digitsPtr" /> length.</param>
+	/// <param name="slice">Double array (it may be dirty).</param>
+	/// <param name="newLength"><paramref name="slice" /> length (see <see cref="GetDoubleDataLength" />).</param>
+	/// <param name="bits">Count of bits per double (see <see cref="GetDoubleDataBits" />).</param>
+	static void ConvertDigitsToDouble(const UInt32 *digitsPtr, const UInt32 length, double *slice, const UInt32 newLength, const int bits)
+	{
 		// Amount of units pointed by digitsPtr
-		UInt32 unitCount = length << DoubleDataLengthShift;
-
-		// Copy all words from digits into new double[]
-		unsigned char* unitDigitsPtr = (unsigned char*)digitsPtr;
-		for (UInt32 i = 0; i < unitCount; ++i)
+		UInt32 unitCount = (UInt32)((((UInt64)length << 5) + bits - 1) / bits);
+		int unitMask = (1 << bits) - 1;
+		int dataBaseDiv2 = 1 << (bits - 1);
+
+		// Copy all bit fields from digits into double[] and "balance" them at once - FHT (as well as FFT) works
+		// more accurate with such data. Each bit field is taken from 64-bit window of two digits, and carry of
+		// balancing is got by comparison, so there are no unpredictable branches here.
+		UInt64 bitIndex = 0, window;
+		int carry = 0, dataDigit;
+		UInt32 i = 0, j;
+		for (; i < unitCount; ++i, bitIndex += bits)
 		{
-			slice[i] = unitDigitsPtr[i];
+			j = (UInt32)(bitIndex >> 5);
+			window = j + 1 < length ? digitsPtr[j] | (UInt64)digitsPtr[j + 1] << 32 : digitsPtr[j];
+			dataDigit = ((int)(window >> (bitIndex & 31)) & unitMask) + carry;
+			carry = dataDigit >= dataBaseDiv2;
+			slice[i] = (double)(dataDigit - (carry << bits));
 		} // end for
 
-		// Clear remaining double values (this array is from pool and may be dirty)
-		DigitHelper::SetBlockDigits(slice + unitCount, newLength - unitCount, 0.0);
-
-		// FHT (as well as FFT) works more accurate with "balanced" data, so let's balance it
-		double carry = 0, dataDigit;
-		for (UInt32 i = 0; i < unitCount || i < newLength && carry != 0; ++i)
+		// Carry of the last bit field goes to the next ones (they are zero)
+		for (; carry != 0 && i < newLength; ++i)
 		{
-			dataDigit = slice[i] + carry;
-			if (dataDigit >= DoubleDataBaseDiv2)
-			{
-				dataDigit -= DoubleDataBase;
-				carry = 1.0;
-			} // end if
-			else
-			{
-				carry = 0;
-			} // end else
-			slice[i] = dataDigit;
+			dataDigit = carry;
+			carry = dataDigit >= dataBaseDiv2;
+			slice[i] = (double)(dataDigit - (carry << bits));
 		} // end for
 
-		if (carry > 0)
+		// Clear remaining double values (this array is from pool and may be dirty)
+		DigitHelper::SetBlockDigits(slice + i, newLength - i, 0.0);
+
+		// Carry out of the whole array goes to its beginning (it's possible for cyclic multiplication only,
+		// see <see cref="GetCyclicDigitsLength" />)
+		if (carry != 0)
 		{
-			slice[0] -= carry;
+			slice[0] += carry;
 		} // end if
-		
-		return data;
 	} // end function ConvertDigitsToDouble
 
 	/// <summary>
@@ -128,69 +182,68 @@ public:
 	/// <param name="length"><paramref name="slice" /> length.</param>
 	/// <param name="digitsLength">New digits array length (we always do know the upper value for this array).</param>
 	/// <param name="digitsResPtr">Resulting digits storage.</param>
-	/// <returns>Big integer digits (dword values).</returns>
-	static void ConvertDoubleToDigits(const double* slice, const UInt32 length, const UInt32 digitsLength, unsigned int *digitsResPtr)
+	/// <param name="bits">Count of bits per double (see <see cref="GetDoubleDataBits" />).</param>
+	/// <returns>Maximal distance between real digit and its rounded value (should be compared with
+	/// <see cref="MaxRoundingError" />).</returns>
+	static double ConvertDoubleToDigits(const double* slice, const UInt32 length, const UInt32 digitsLength, unsigned int *digitsResPtr, const int bits)
 	{
 		// Calculate data multiplier (don't forget about additional div 2)
 		double normalizeMultiplier = 0.5 / length;
 
 		// Count of units in digits
-		UInt32 unitCount = digitsLength << DoubleDataLengthShift;
+		UInt32 unitCount = (UInt32)((((UInt64)digitsLength << 5) + bits - 1) / bits);
+		long long unitMask = (1LL << bits) - 1;
 
 		// Carry and current digit
-		double carry = 0, dataDigit;
+		double maxRoundingError = 0.0;
 		long long carryInt = 0, dataDigitInt;
 
-		// Walk thru all double digits
-		char* unitDigitsPtr = (char*)digitsResPtr;
-		for (UInt32 i = 0; i < length; ++i)
-		{
-			// Get data digit (don't forget it might be balanced)
-			dataDigit = slice[i] * normalizeMultiplier;
-
-			// Round to the nearest
-			dataDigitInt = (long long)(dataDigit < 0 ? dataDigit - 0.5 : dataDigit + 0.5) + carryInt;
-
-			// Get next carry floored; maybe modify data digit
-			carry = dataDigitInt / DoubleDataBase;
-			if (carry < 0)
-			{
-				carry += (long long(carry) % 1);
-			} // end if
-			carryInt = (long long)carry;
-
-			dataDigitInt -= carryInt << DoubleDataDigitShift;
-			if (dataDigitInt < 0)
-			{
-				dataDigitInt += DoubleDataBaseInt;
-				--carryInt;
-			} // end if
+		// Bit fields which are not stored into digits yet
+		UInt64 buffer = 0;
+		int bufferBits = 0, fullBits;
+		UInt32 digitIndex = 0, i = 0;
 
-			// Maybe add to the digits
-			if (i < unitCount)
-			{
-				unitDigitsPtr[i] = (char)dataDigitInt;
-			} // end if
+		// Walk thru double digits which make result digits. Current digit is stored after each bit field
+		// (it's overwritten until it's full), so there are no unpredictable branches here.
+		for (; i < unitCount; ++i)
+		{
+			// Get data digit (don't forget it might be balanced) and next carry floored
+			// (lower bits are unsigned data digit)
+			dataDigitInt = RoundDataDigit(slice[i] * normalizeMultiplier, maxRoundingError) + carryInt;
+			carryInt = dataDigitInt >> bits;
+			dataDigitInt &= unitMask;
+
+			buffer |= (UInt64)dataDigitInt << bufferBits;
+			bufferBits += bits;
+			digitsResPtr[digitIndex] = (UInt32)buffer;
+
+			fullBits = bufferBits & 32;
+			digitIndex += fullBits >> 5;
+			buffer >>= fullBits;
+			bufferBits -= fullBits;
 		} // end for
 
-		// Last carry must be accounted
-		if (carryInt < 0)
+		// Other double digits are just carried
+		for (; i < length; ++i)
 		{
-			digitsResPtr[0] -= (UInt32)-carryInt;
-		} // end if
-		else if (carryInt > 0)
+			carryInt = (RoundDataDigit(slice[i] * normalizeMultiplier, maxRoundingError) + carryInt) >> bits;
+		} // end for
+
+		// Last carry must be accounted: usual multiplication result fits into digits, so it's nonzero only for
+		// cyclic one - it's added to the lower digits (as well as carry out of them) since 2^(32 * digitsLength) = 1
+		while (carryInt != 0)
 		{
-			UInt32 digitsCarry = (UInt32)carryInt, oldDigit;
+			long long digitsCarry = carryInt;
 			for (UInt32 i = 0; digitsCarry != 0 && i < digitsLength; ++i)
 			{
-				oldDigit = digitsResPtr[i];
-				digitsResPtr[i] += digitsCarry;
-
-				// Check for an overflow
-				digitsCarry = digitsResPtr[i] < oldDigit ? 1U : 0U;
+				digitsCarry += digitsResPtr[i];
+				digitsResPtr[i] = (UInt32)digitsCarry;
+				digitsCarry >>= 32;
 			} // end for
-		} // end else if
+			carryInt = digitsCarry;
+		} // end while
 
+		return maxRoundingError;
 	} // end function ConvertDoubleToDigits
 
 	/// <summary>
@@ -205,6 +258,37 @@ public:
 		Fht(slice, length, Bits::Msb(length));
 	} // end function Fht
 
+	/// <summary>
+	/// Performs FHT "in place" for given double[] array using several threads: "butterflies" of upper
+	/// recursion levels are split between parallel tasks, then each task transforms its own slice.
+	/// </summary>
+	/// <param name="array">Double array.</param>
+	/// <param name="length">Array length.</param>
+	/// <param name="threadCount">Maximal count of threads.</param>
+	static void ParallelFht(double *array, const UInt32 length, const UInt32 threadCount)
+	{
+		UInt32 taskCount = GetParallelTaskCount(length, threadCount);
+		if (taskCount == 1)
+		{
+			Fht(array, length);
+			return;
+		} // end if
+
+		int lengthLog2 = Bits::Msb(length);
+		int taskCountLog2 = Bits::Msb(taskCount);
+
+		for (int levelLog2 = 0; levelLog2 < taskCountLog2; ++levelLog2)
+		{
+			RunButterflyTasks(array, lengthLog2 - levelLog2, taskCountLog2 - levelLog2, threadCount, taskCount, false);
+		} // end for
+
+		UInt32 sliceLength = length >> taskCountLog2;
+		ThreadPool::Run(threadCount, taskCount, [=](UInt32 task)
+		{
+			Fht(array + task * sliceLength, sliceLength, lengthLog2 - taskCountLog2);
+		});
+	} // end function ParallelFht
+
 	/// <summary>
 	/// Performs FHT "in place" for given double[] array slice.
 	/// </summary>
@@ -216,54 +300,37 @@ public:
 		UInt32 length = vlength;
 		int lengthLog2 = vlengthLog2;
 
-		// Special fast processing for length == 4
-		if (length == 4)
+		// Short slices are transformed by codelets
+		if (length <= Constants::FhtCodeletLengthMax)
 		{
-			Fht4(slice);
+			ShortFht(slice, lengthLog2);
+			return;
+		} // end if
+
+		// Long slice is divided into 4 parts at once (two levels of "butterflies" are done in one pass over data)
+		if (length >= Constants::FhtBlockedLengthLowerBound)
+		{
+			BlockedFhtButterflies(slice, length, lengthLog2, false);
+
+			length >>= 2;
+			lengthLog2 -= 2;
+			for (UInt32 i = 0; i < 4; ++i)
+			{
+				Fht(slice + i * length, length, lengthLog2);
+			} // end for
 			return;
 		} // end if
 
 		// Divide data into 2 recursively processed parts
 		length >>= 1;
 		--lengthLog2;
-		double* rightSlice = slice + length;
-
-		UInt32 lengthDiv2 = length >> 1;
-		UInt32 lengthDiv4 = length >> 2;
-
-		// Perform initial "butterfly" operations over left and right array parts
-		double leftDigit = slice[0];
-		double rightDigit = rightSlice[0];
-		slice[0] = leftDigit + rightDigit;
-		rightSlice[0] = leftDigit - rightDigit;
-
-		leftDigit = slice[lengthDiv2];
-		rightDigit = rightSlice[lengthDiv2];
-		slice[lengthDiv2] = leftDigit + rightDigit;
-		rightSlice[lengthDiv2] = leftDigit - rightDigit;
-
-		// Get initial trig values
-		//TrigValues trigValues = GetInitialTrigValues(lengthLog2);
-		//trigValues = new TrigValues();
-		TrigValues trigValues;
-		GetInitialTrigValues(trigValues, lengthLog2);
-
-		// Perform "butterfly"
-		for (UInt32 i = 1; i < lengthDiv4; ++i)
-		{
-			FhtButterfly(slice, rightSlice, i, length - i, trigValues.Cos, trigValues.Sin);
-			FhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, trigValues.Sin, trigValues.Cos);
-
-			// Get next trig values
-			NextTrigValues(trigValues);
-		} // end for
 
-		// Final "butterfly"
-		FhtButterfly(slice, rightSlice, lengthDiv4, length - lengthDiv4, Sqrt2Div2, Sqrt2Div2);
+		// Perform "butterfly" operations over left and right array parts
+		FhtButterflies(slice, length, lengthLog2, 0, (length >> 2) + 1);
 
 		// Finally perform recursive run
 		Fht(slice, length, lengthLog2);
-		Fht(rightSlice, length, lengthLog2);
+		Fht(slice + length, length, lengthLog2);
 	} // end function Fht
 	
 	/// <summary>
@@ -272,31 +339,66 @@ public:
 	/// <param name="slice">First FHT result.</param>
 	/// <param name="slice2">Second FHT result.</param>
 	/// <param name="length">FHT results length.</param>
-	static void MultiplyFhtResults(double* slice, double* slice2, const UInt32 length)
+	static void MultiplyFhtResults(double* slice, const double* slice2, const UInt32 length)
 	{
 		// Step0 and Step1
 		slice[0] *= 2.0 * slice2[0];
 		slice[1] *= 2.0 * slice2[1];
 
 		// Perform all other steps
-		double d11, d12, d21, d22, ad, sd;
-		for (UInt32 stepStart = 2, stepEnd = 4, index1, index2; stepStart < length; stepStart *= 2, stepEnd *= 2)
+		for (UInt32 stepStart = 2, stepEnd = 4; stepStart < length; stepStart *= 2, stepEnd *= 2)
 		{
-			for (index1 = stepStart, index2 = stepEnd - 1; index1 < stepEnd; index1 += 2, index2 -= 2)
+			MultiplyFhtStep(slice, slice2, stepStart, stepEnd, stepStart, (stepStart + stepEnd) >> 1);
+		} // end for
+	} // end function MultiplyFhtResults
+
+	/// <summary>
+	/// Converts <see cref="IntX" /> digits into existing real representation and performs FHT of it; if other FHT result
+	/// is given, both of them are multiplied at once (see <see cref="MultiplyFhtResults" />). Single-threaded transform
+	/// is fused with its neighbour steps, so data isn't passed over separately for them: if digits take lower half of
+	/// the array only, upper half is made by the first level of "butterflies" from it, and FHT results are multiplied
+	/// by cache-sized blocks as soon as they are transformed.
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length"><paramref name="digitsPtr" /> length.</param>
+	/// <param name="slice">Double array (it may be dirty), gets FHT result or multiplication.</param>
+	/// <param name="newLength"><paramref name="slice" /> length (see <see cref="GetDoubleDataLength" />).</param>
+	/// <param name="bits">Count of bits per double (see <see cref="GetDoubleDataBits" />).</param>
+	/// <param name="threadCount">Maximal count of threads.</param>
+	/// <param name="slice2">Other FHT result (may be the same as <paramref name="slice" /> for squaring) or null.</param>
+	static void ConvertDigitsToFht(const UInt32 *digitsPtr, const UInt32 length, double *slice, const UInt32 newLength, const int bits,
+		const UInt32 threadCount, const double *slice2)
+	{
+		// Parallel transform isn't fused
+		if (GetParallelTaskCount(newLength, threadCount) > 1)
+		{
+			ConvertDigitsToDouble(digitsPtr, length, slice, newLength, bits);
+			ParallelFht(slice, newLength, threadCount);
+			if (slice2 != nullptr)
 			{
-				d11 = slice[index1];
-				d12 = slice[index2];
-				d21 = slice2[index1];
-				d22 = slice2[index2];
+				MultiplyFhtResults(slice, slice2, newLength);
+			} // end if
+			return;
+		} // end if
 
-				ad = d11 + d12;
-				sd = d11 - d12;
+		UInt32 unitCount = (UInt32)((((UInt64)length << 5) + bits - 1) / bits);
+		UInt32 partLength = newLength >> 1;
+		int lengthLog2 = Bits::Msb(newLength);
 
-				slice[index1] = d21 * ad + d22 * sd;
-				slice[index2] = d22 * ad - d21 * sd;
-			} // end for
-		} // end for
-	} // end function MultiplyFhtResults
+		// Upper half is zero if carry of balancing stops right after digits (it does if each double keeps at least 2 bits)
+		if (unitCount < partLength && bits > 1)
+		{
+			ConvertDigitsToDouble(digitsPtr, length, slice, partLength, bits);
+			ZeroRightFhtButterflies(slice, partLength, lengthLog2 - 1);
+			FhtMultiply(slice, slice2, 0, partLength, lengthLog2 - 1);
+			FhtMultiply(slice, slice2, partLength, partLength, lengthLog2 - 1);
+		} // end if
+		else
+		{
+			ConvertDigitsToDouble(digitsPtr, length, slice, newLength, bits);
+			FhtMultiply(slice, slice2, 0, newLength, lengthLog2);
+		} // end else
+	} // end function ConvertDigitsToFht
 
 	/// <summary>
 	/// Performs FHT reverse "in place" for given double[] array.
@@ -311,56 +413,454 @@ public:
 	} // end function ReverseFht
 
 	/// <summary>
-	/// Performs reverse FHT "in place" for given double[] array slice.
+	/// Performs reverse FHT "in place" for given double[] array using several threads: each task transforms
+	/// its own slice, then "butterflies" of upper recursion levels are split between parallel tasks.
+	/// </summary>
+	/// <param name="array">Double array.</param>
+	/// <param name="length">Array length.</param>
+	/// <param name="threadCount">Maximal count of threads.</param>
+	static void ParallelReverseFht(double *array, const UInt32 length, const UInt32 threadCount)
+	{
+		UInt32 taskCount = GetParallelTaskCount(length, threadCount);
+		if (taskCount == 1)
+		{
+			ReverseFht(array, length);
+			return;
+		} // end if
+
+		int lengthLog2 = Bits::Msb(length);
+		int taskCountLog2 = Bits::Msb(taskCount);
+
+		UInt32 sliceLength = length >> taskCountLog2;
+		ThreadPool::Run(threadCount, taskCount, [=](UInt32 task)
+		{
+			ReverseFht(array + task * sliceLength, sliceLength, lengthLog2 - taskCountLog2);
+		});
+
+		for (int levelLog2 = taskCountLog2 - 1; levelLog2 >= 0; --levelLog2)
+		{
+			RunButterflyTasks(array, lengthLog2 - levelLog2, taskCountLog2 - levelLog2, threadCount, taskCount, true);
+		} // end for
+	} // end function ParallelReverseFht
+
+	/// <summary>
+	/// Performs reverse FHT "in place" for given double[] array slice.
+	/// </summary>
+	/// <param name="slice">Double array slice.</param>
+	/// <param name="length">Slice length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	static void ReverseFht(double* slice, const UInt32 vlength, const int vlengthLog2)
+	{
+		UInt32 length = vlength;
+		int lengthLog2 = vlengthLog2;
+
+		// Short slices are transformed by codelets
+		if (length <= Constants::FhtCodeletLengthMax)
+		{
+			ShortReverseFht(slice, lengthLog2);
+			return;
+		} // end if
+
+		// Long slice is joined from 4 parts at once (two levels of "butterflies" are done in one pass over data)
+		if (length >= Constants::FhtBlockedLengthLowerBound)
+		{
+			UInt32 partLength = length >> 2;
+			for (UInt32 i = 0; i < 4; ++i)
+			{
+				ReverseFht(slice + i * partLength, partLength, lengthLog2 - 2);
+			} // end for
+
+			BlockedFhtButterflies(slice, length, lengthLog2, true);
+			return;
+		} // end if
+
+		// Divide data into 2 recursively processed parts
+		length >>= 1;
+		--lengthLog2;
+
+		// Perform recursive run
+		ReverseFht(slice, length, lengthLog2);
+		ReverseFht(slice + length, length, lengthLog2);
+
+		// Perform "butterfly" operations over left and right array parts
+		ReverseFhtButterflies(slice, length, lengthLog2, 0, (length >> 2) + 1);
+	} // end function ReverseFht
+		
+private:
+
+	/// <summary>
+	/// Returns count of parallel tasks for FHT of given length: power of 2 not less than thread count
+	/// (or 1 if transform is too short to be split).
+	/// </summary>
+	/// <param name="length">Transform length.</param>
+	/// <param name="threadCount">Maximal count of threads.</param>
+	/// <returns>Task count.</returns>
+	static UInt32 GetParallelTaskCount(const UInt32 length, const UInt32 threadCount)
+	{
+		if (threadCount <= 1 || length < Constants::FhtParallelLengthLowerBound) return 1;
+
+		// Slices of tasks must be long enough to hold whole vectors of "butterfly" chunks
+		UInt32 taskCount = 1U << Bits::CeilLog2(threadCount);
+		while (taskCount > 1 && length / taskCount < 4096)
+		{
+			taskCount >>= 1;
+		} // end while
+		return taskCount;
+	} // end function GetParallelTaskCount
+
+	/// <summary>
+	/// Performs "butterfly" operations of one recursion level in parallel: "butterflies" of each slice
+	/// are split into chunks, one chunk per task.
+	/// </summary>
+	/// <param name="array">Double array.</param>
+	/// <param name="sliceLengthLog2">Log2(length of slices processed on this level).</param>
+	/// <param name="chunkCountLog2">Log2(count of chunks per slice).</param>
+	/// <param name="threadCount">Maximal count of threads.</param>
+	/// <param name="taskCount">Count of tasks (slice count multiplied by chunk count).</param>
+	/// <param name="isReverse">True for reverse FHT.</param>
+	static void RunButterflyTasks(double *array, const int sliceLengthLog2, const int chunkCountLog2,
+		const UInt32 threadCount, const UInt32 taskCount, const bool isReverse)
+	{
+		UInt32 length = 1U << (sliceLengthLog2 - 1);
+		UInt32 chunkLength = (length >> 2) >> chunkCountLog2;
+		UInt32 lastChunk = (1U << chunkCountLog2) - 1;
+
+		ThreadPool::Run(threadCount, taskCount, [=](UInt32 task)
+		{
+			double* slice = array + ((task >> chunkCountLog2) << sliceLengthLog2);
+			UInt32 chunk = task & lastChunk;
+
+			// The last chunk also gets the final "butterfly"
+			UInt32 begin = chunk * chunkLength;
+			UInt32 end = chunk == lastChunk ? (length >> 2) + 1 : begin + chunkLength;
+			if (isReverse)
+			{
+				ReverseFhtButterflies(slice, length, sliceLengthLog2 - 1, begin, end);
+			} // end if
+			else
+			{
+				FhtButterflies(slice, length, sliceLengthLog2 - 1, begin, end);
+			} // end else
+		});
+	} // end function RunButterflyTasks
+
+	/// <summary>
+	/// Performs FHT "in place" for given slice of double[] array; if other FHT result is given, transformed values are
+	/// multiplied by it (see <see cref="MultiplyFhtResults" />) as soon as slice recursion gets to cache-sized blocks.
+	/// </summary>
+	/// <param name="array">Double array.</param>
+	/// <param name="array2">Other FHT result (may be the same as <paramref name="array" />) or null.</param>
+	/// <param name="offset">Slice offset.</param>
+	/// <param name="length">Slice length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	static void FhtMultiply(double* array, const double* array2, const UInt32 offset, const UInt32 vlength, const int vlengthLog2)
+	{
+		double* slice = array + offset;
+		UInt32 length = vlength;
+		int lengthLog2 = vlengthLog2;
+
+		if (array2 == nullptr || length <= Constants::FhtMultiplyBlockLength)
+		{
+			Fht(slice, length, lengthLog2);
+			if (array2 != nullptr)
+			{
+				MultiplyFhtBlock(array, array2, offset, length);
+			} // end if
+			return;
+		} // end if
+
+		// Recursion is the same as in <see cref="Fht(double*, uint, int)" />
+		if (length >= Constants::FhtBlockedLengthLowerBound)
+		{
+			BlockedFhtButterflies(slice, length, lengthLog2, false);
+
+			length >>= 2;
+			lengthLog2 -= 2;
+			for (UInt32 i = 0; i < 4; ++i)
+			{
+				FhtMultiply(array, array2, offset + i * length, length, lengthLog2);
+			} // end for
+			return;
+		} // end if
+
+		length >>= 1;
+		--lengthLog2;
+
+		FhtButterflies(slice, length, lengthLog2, 0, (length >> 2) + 1);
+		FhtMultiply(array, array2, offset, length, lengthLog2);
+		FhtMultiply(array, array2, offset + length, length, lengthLog2);
+	} // end function FhtMultiply
+
+	/// <summary>
+	/// Multiplies FHT results in given block of transformed values. Values of each step of <see cref="MultiplyFhtResults" />
+	/// are paired from both step ends, so block is multiplied along with its mirrored one when the later of them is done
+	/// (blocks are transformed in ascending order); the first block takes whole steps.
+	/// </summary>
+	/// <param name="array">First FHT result.</param>
+	/// <param name="array2">Second FHT result.</param>
+	/// <param name="offset">Block offset (multiple of block length).</param>
+	/// <param name="length">Block length (at least 16).</param>
+	static void MultiplyFhtBlock(double* array, const double* array2, const UInt32 offset, const UInt32 length)
+	{
+		if (offset == 0)
+		{
+			MultiplyFhtResults(array, array2, length);
+			return;
+		} // end if
+
+		UInt32 stepStart = 1U << Bits::Msb(offset), stepEnd = stepStart << 1;
+		UInt32 mirrorOffset = stepStart + stepEnd - offset - length;
+		if (mirrorOffset < offset)
+		{
+			MultiplyFhtStep(array, array2, stepStart, stepEnd, mirrorOffset, mirrorOffset + length);
+		} // end if
+		else if (mirrorOffset == offset)
+		{
+			// Block is the whole step
+			MultiplyFhtStep(array, array2, stepStart, stepEnd, offset, offset + (length >> 1));
+		} // end if
+	} // end function MultiplyFhtBlock
+
+	/// <summary>
+	/// Performs one step of <see cref="MultiplyFhtResults" /> for given values of its lower half and mirrored values
+	/// of the upper one: even values of each part are paired with odd values of another part (in reverse order).
+	/// </summary>
+	/// <param name="slice">First FHT result.</param>
+	/// <param name="slice2">Second FHT result.</param>
+	/// <param name="stepStart">Step start index.</param>
+	/// <param name="stepEnd">Step end index.</param>
+	/// <param name="begin">First index of the lower half of step (multiple of 8 for steps of 16 and more values).</param>
+	/// <param name="end">Index after the last one (the same).</param>
+	static void MultiplyFhtStep(double* slice, const double* slice2, const UInt32 stepStart, const UInt32 stepEnd,
+		const UInt32 begin, const UInt32 end)
+	{
+#ifdef INTX_FHT_SIMD
+		// Steps of 16 and more values are processed by whole vectors
+		if (isSimdSupported && stepStart >= 16)
+		{
+			MultiplyFhtStepAvx2(slice, slice2, stepStart, stepEnd, begin, end);
+			return;
+		} // end if
+#endif
+		UInt32 mirrorSum = stepStart + stepEnd - 1, index1;
+		for (index1 = begin; index1 < end; index1 += 2)
+		{
+			MultiplyFhtValues(slice, slice2, index1, mirrorSum - index1);
+		} // end for
+		for (index1 = (mirrorSum + 2 - end) & ~1U; index1 <= mirrorSum - begin; index1 += 2)
+		{
+			MultiplyFhtValues(slice, slice2, index1, mirrorSum - index1);
+		} // end for
+	} // end function MultiplyFhtStep
+
+	/// <summary>
+	/// Multiplies pair of values of two FHT results (see <see cref="MultiplyFhtResults" />).
+	/// </summary>
+	/// <param name="slice">First FHT result.</param>
+	/// <param name="slice2">Second FHT result.</param>
+	/// <param name="index1">Index of even value of step.</param>
+	/// <param name="index2">Index of paired odd value.</param>
+	static void MultiplyFhtValues(double* slice, const double* slice2, const UInt32 index1, const UInt32 index2)
+	{
+		double d11 = slice[index1];
+		double d12 = slice[index2];
+		double d21 = slice2[index1];
+		double d22 = slice2[index2];
+
+		double ad = d11 + d12;
+		double sd = d11 - d12;
+
+		slice[index1] = d21 * ad + d22 * sd;
+		slice[index2] = d22 * ad - d21 * sd;
+	} // end function MultiplyFhtValues
+
+	/// <summary>
+	/// Performs "butterfly" operations of two upper recursion levels of <see cref="Fht(double*, uint, int)" />
+	/// (or two lower ones of <see cref="ReverseFht(double*, uint, int)" />) for long slice in one pass over data.
+	/// "Butterfly" number i of the lower level (in both halves of slice) takes values of upper level ones
+	/// i and lengthDiv8 * 2 - i only, so they are done by chunks of numbers from both ends - values of the
+	/// chunk are still in cache when the next level takes them.
+	/// </summary>
+	/// <param name="slice">Data array slice.</param>
+	/// <param name="length">Slice length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	/// <param name="isReverse">True for reverse FHT.</param>
+	static void BlockedFhtButterflies(double* slice, const UInt32 length, const int lengthLog2, const bool isReverse)
+	{
+		UInt32 partLength = length >> 1;
+		UInt32 quarterLength = length >> 2;
+		UInt32 lengthDiv8 = length >> 3;
+		UInt32 lastNumber = lengthDiv8 >> 1;
+
+		for (UInt32 begin = 0, end, highBegin, highEnd; begin <= lastNumber; begin = end)
+		{
+			// Numbers of the upper level from both ends (the middle one is taken once)
+			end = begin + Constants::FhtBlockedChunkLength < lastNumber + 1 ? begin + Constants::FhtBlockedChunkLength : lastNumber + 1;
+			highBegin = lengthDiv8 + 1 - end < end ? end : lengthDiv8 + 1 - end;
+			highEnd = lengthDiv8 + 1 - begin;
+
+			if (isReverse)
+			{
+				ReverseFhtButterflies(slice, quarterLength, lengthLog2 - 2, begin, end);
+				ReverseFhtButterflies(slice + partLength, quarterLength, lengthLog2 - 2, begin, end);
+				ReverseFhtButterflies(slice, partLength, lengthLog2 - 1, begin, end);
+				if (highBegin < highEnd)
+				{
+					ReverseFhtButterflies(slice, partLength, lengthLog2 - 1, highBegin, highEnd);
+				} // end if
+			} // end if
+			else
+			{
+				FhtButterflies(slice, partLength, lengthLog2 - 1, begin, end);
+				if (highBegin < highEnd)
+				{
+					FhtButterflies(slice, partLength, lengthLog2 - 1, highBegin, highEnd);
+				} // end if
+				FhtButterflies(slice, quarterLength, lengthLog2 - 2, begin, end);
+				FhtButterflies(slice + partLength, quarterLength, lengthLog2 - 2, begin, end);
+			} // end else
+		} // end for
+	} // end function BlockedFhtButterflies
+
+	/// <summary>
+	/// Performs "butterfly" operations with given numbers for <see cref="Fht(double*, uint, int)" />:
+	/// number 0 is the initial one, 1..lengthDiv4-1 are usual ones and lengthDiv4 is the final one.
+	/// </summary>
+	/// <param name="slice">Left part of data array slice (right part follows it).</param>
+	/// <param name="length">Part length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	/// <param name="begin">First "butterfly" number.</param>
+	/// <param name="end">Number after the last "butterfly".</param>
+	static void FhtButterflies(double* slice, const UInt32 length, const int lengthLog2, const UInt32 begin, const UInt32 end)
+	{
+		double* rightSlice = slice + length;
+
+		UInt32 lengthDiv2 = length >> 1;
+		UInt32 lengthDiv4 = length >> 2;
+		UInt32 usualEnd = end < lengthDiv4 ? end : lengthDiv4;
+		UInt32 i = begin;
+
+		// Perform initial "butterfly" operations over left and right array parts
+		if (i == 0)
+		{
+			double leftDigit = slice[0];
+			double rightDigit = rightSlice[0];
+			slice[0] = leftDigit + rightDigit;
+			rightSlice[0] = leftDigit - rightDigit;
+
+			leftDigit = slice[lengthDiv2];
+			rightDigit = rightSlice[lengthDiv2];
+			slice[lengthDiv2] = leftDigit + rightDigit;
+			rightSlice[lengthDiv2] = leftDigit - rightDigit;
+			++i;
+		} // end if
+
+		// Perform "butterfly"
+#ifdef INTX_FHT_SIMD
+		if (isSimdSupported && (length << 1) >= Constants::FhtSimdLengthLowerBound)
+		{
+			i = FhtButterfliesAvx2(slice, rightSlice, length, lengthLog2, i, usualEnd);
+		} // end if
+#endif
+		double cos, sin;
+		for (; i < usualEnd; ++i)
+		{
+			GetTwiddle(lengthLog2, i, cos, sin);
+			FhtButterfly(slice, rightSlice, i, length - i, cos, sin);
+			FhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sin, cos);
+		} // end for
+
+		// Final "butterfly"
+		if (end > lengthDiv4)
+		{
+			FhtButterfly(slice, rightSlice, lengthDiv4, length - lengthDiv4, Sqrt2Div2, Sqrt2Div2);
+		} // end if
+	} // end function FhtButterflies
+
+	/// <summary>
+	/// Performs "butterfly" operations of the upper recursion level of <see cref="Fht(double*, uint, int)" /> when
+	/// right part of data array slice is zero: right part is just made from the left one (which stays the same).
 	/// </summary>
-	/// <param name="slice">Double array slice.</param>
-	/// <param name="length">Slice length.</param>
+	/// <param name="slice">Left part of data array slice (right part follows it, it may be dirty).</param>
+	/// <param name="length">Part length.</param>
 	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
-	static void ReverseFht(double* slice, const UInt32 vlength, const int vlengthLog2)
+	static void ZeroRightFhtButterflies(double* slice, const UInt32 length, const int lengthLog2)
 	{
-		UInt32 length = vlength;
-		int lengthLog2 = vlengthLog2;
+		double* rightSlice = slice + length;
+
+		UInt32 lengthDiv2 = length >> 1;
+		UInt32 lengthDiv4 = length >> 2;
+		UInt32 i = 1;
 
-		// Special fast processing for length == 8
-		if (length == 8)
+		// Initial "butterfly" operations
+		rightSlice[0] = slice[0];
+		rightSlice[lengthDiv2] = slice[lengthDiv2];
+
+		// Perform "butterfly"
+#ifdef INTX_FHT_SIMD
+		if (isSimdSupported && (length << 1) >= Constants::FhtSimdLengthLowerBound)
 		{
-			ReverseFht8(slice);
-			return;
+			i = ZeroRightFhtButterfliesAvx2(slice, rightSlice, length, lengthLog2, i, lengthDiv4);
 		} // end if
+#endif
+		double cos, sin;
+		for (; i < lengthDiv4; ++i)
+		{
+			GetTwiddle(lengthLog2, i, cos, sin);
+			ZeroRightFhtButterfly(slice, rightSlice, i, length - i, cos, sin);
+			ZeroRightFhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sin, cos);
+		} // end for
 
-		// Divide data into 2 recursively processed parts
-		length >>= 1;
-		--lengthLog2;
+		// Final "butterfly"
+		ZeroRightFhtButterfly(slice, rightSlice, lengthDiv4, length - lengthDiv4, Sqrt2Div2, Sqrt2Div2);
+	} // end function ZeroRightFhtButterflies
+
+	/// <summary>
+	/// Performs "butterfly" operations with given numbers for <see cref="ReverseFht(double*, uint, int)" />:
+	/// number 0 is the initial one, 1..lengthDiv4-1 are usual ones and lengthDiv4 is the final one.
+	/// </summary>
+	/// <param name="slice">Left part of data array slice (right part follows it).</param>
+	/// <param name="length">Part length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	/// <param name="begin">First "butterfly" number.</param>
+	/// <param name="end">Number after the last "butterfly".</param>
+	static void ReverseFhtButterflies(double* slice, const UInt32 length, const int lengthLog2, const UInt32 begin, const UInt32 end)
+	{
 		double* rightSlice = slice + length;
 
 		UInt32 lengthDiv2 = length >> 1;
 		UInt32 lengthDiv4 = length >> 2;
-
-		// Perform recursive run
-		ReverseFht(slice, length, lengthLog2);
-		ReverseFht(rightSlice, length, lengthLog2);
-
-		// Get initial trig values
-		TrigValues trigValues;
-		GetInitialTrigValues(trigValues, lengthLog2);
+		UInt32 usualEnd = end < lengthDiv4 ? end : lengthDiv4;
+		UInt32 i = begin == 0 ? 1 : begin;
 
 		// Perform "butterfly"
-		for (UInt32 i = 1; i < lengthDiv4; ++i)
+#ifdef INTX_FHT_SIMD
+		if (isSimdSupported && (length << 1) >= Constants::FhtSimdLengthLowerBound)
 		{
-			ReverseFhtButterfly(slice, rightSlice, i, length - i, trigValues.Cos, trigValues.Sin);
-			ReverseFhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, trigValues.Sin, trigValues.Cos);
-
-			// Get next trig values
-			NextTrigValues(trigValues);
+			i = ReverseFhtButterfliesAvx2(slice, rightSlice, length, lengthLog2, i, usualEnd);
+		} // end if
+#endif
+		double cos, sin;
+		for (; i < usualEnd; ++i)
+		{
+			GetTwiddle(lengthLog2, i, cos, sin);
+			ReverseFhtButterfly(slice, rightSlice, i, length - i, cos, sin);
+			ReverseFhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sin, cos);
 		} // end for
 
 		// Final "butterfly"
-		ReverseFhtButterfly(slice, rightSlice, lengthDiv4, length - lengthDiv4, Sqrt2Div2, Sqrt2Div2);
-		ReverseFhtButterfly2(slice, rightSlice, 0, 0, 1.0, 0);
-		ReverseFhtButterfly2(slice, rightSlice, lengthDiv2, lengthDiv2, 0, 1.0);
-	} // end function ReverseFht
-		
-private:
+		if (end > lengthDiv4)
+		{
+			ReverseFhtButterfly(slice, rightSlice, lengthDiv4, length - lengthDiv4, Sqrt2Div2, Sqrt2Div2);
+		} // end if
+
+		// Initial "butterfly" operations
+		if (begin == 0)
+		{
+			ReverseFhtButterfly2(slice, rightSlice, 0, 0, 1.0, 0);
+			ReverseFhtButterfly2(slice, rightSlice, lengthDiv2, lengthDiv2, 0, 1.0);
+		} // end if
+	} // end function ReverseFhtButterflies
 	
 	/// <summary>
 	/// Performs FHT "in place" for given double[] array slice.
@@ -457,6 +957,24 @@ private:
 		slice2[index2] = d11 * sin - d12 * cos;
 	} // end function FhtButterfly
 
+	/// <summary>
+	/// Performs "butterfly" operation for <see cref="Fht(double*, uint, int)" /> when second slice values are zero.
+	/// </summary>
+	/// <param name="slice1">First data array slice.</param>
+	/// <param name="slice2">Second data array slice.</param>
+	/// <param name="index1">First slice index.</param>
+	/// <param name="index2">Second slice index.</param>
+	/// <param name="cos">Cos value.</param>
+	/// <param name="sin">Sin value.</param>
+	static void ZeroRightFhtButterfly(const double* slice1, double* slice2, const UInt32 index1, const UInt32 index2, const double cos, const double sin)
+	{
+		double d11 = slice1[index1];
+		double d12 = slice1[index2];
+
+		slice2[index1] = d11 * cos + d12 * sin;
+		slice2[index2] = d11 * sin - d12 * cos;
+	} // end function ZeroRightFhtButterfly
+
 	/// <summary>
 	/// Performs reverse FHT "in place" for given double[] array slice.
 	/// Fast version for length == 8.
@@ -508,48 +1026,603 @@ private:
 	} // end function ReverseFht8
 
 	/// <summary>
-	/// Fills sine table for FHT.
+	/// Performs FHT "in place" for given short double[] array slice by codelet of its length.
+	/// </summary>
+	/// <param name="slice">Double array slice.</param>
+	/// <param name="lengthLog2">Log2(slice length), from 2 to Log2(<see cref="Constants::FhtCodeletLengthMax" />).</param>
+	static void ShortFht(double* slice, const int lengthLog2)
+	{
+		switch (lengthLog2)
+		{
+		case 2: FhtCodelet(slice, integral_constant<int, 2>()); break;
+		case 3: FhtCodelet(slice, integral_constant<int, 3>()); break;
+		case 4: FhtCodelet(slice, integral_constant<int, 4>()); break;
+		case 5: FhtCodelet(slice, integral_constant<int, 5>()); break;
+		case 6: FhtCodelet(slice, integral_constant<int, 6>()); break;
+		case 7: FhtCodelet(slice, integral_constant<int, 7>()); break;
+		case 8: FhtCodelet(slice, integral_constant<int, 8>()); break;
+		case 9: FhtCodelet(slice, integral_constant<int, 9>()); break;
+		case 10: FhtCodelet(slice, integral_constant<int, 10>()); break;
+		} // end switch
+	} // end function ShortFht
+
+	/// <summary>
+	/// Performs reverse FHT "in place" for given short double[] array slice by codelet of its length.
+	/// </summary>
+	/// <param name="slice">Double array slice.</param>
+	/// <param name="lengthLog2">Log2(slice length), from 3 to Log2(<see cref="Constants::FhtCodeletLengthMax" />).</param>
+	static void ShortReverseFht(double* slice, const int lengthLog2)
+	{
+		switch (lengthLog2)
+		{
+		case 3: ReverseFhtCodelet(slice, integral_constant<int, 3>()); break;
+		case 4: ReverseFhtCodelet(slice, integral_constant<int, 4>()); break;
+		case 5: ReverseFhtCodelet(slice, integral_constant<int, 5>()); break;
+		case 6: ReverseFhtCodelet(slice, integral_constant<int, 6>()); break;
+		case 7: ReverseFhtCodelet(slice, integral_constant<int, 7>()); break;
+		case 8: ReverseFhtCodelet(slice, integral_constant<int, 8>()); break;
+		case 9: ReverseFhtCodelet(slice, integral_constant<int, 9>()); break;
+		case 10: ReverseFhtCodelet(slice, integral_constant<int, 10>()); break;
+		} // end switch
+	} // end function ShortReverseFht
+
+	/// <summary>
+	/// Performs FHT "in place" for slice of 2^LengthLog2 doubles (codelet). Recursion of <see cref="Fht(double*, uint, int)" />
+	/// is unrolled at compile time, so all part lengths are constant and short "butterfly" loops become straight-line code.
+	/// </summary>
+	/// <param name="slice">Double array slice.</param>
+	template <int LengthLog2>
+	static void FhtCodelet(double* slice, integral_constant<int, LengthLog2>)
+	{
+		const UInt32 length = 1U << (LengthLog2 - 1);
+
+		FhtCodeletButterflies<LengthLog2 - 1>(slice);
+		FhtCodelet(slice, integral_constant<int, LengthLog2 - 1>());
+		FhtCodelet(slice + length, integral_constant<int, LengthLog2 - 1>());
+	} // end function FhtCodelet
+
+	/// <summary>
+	/// Performs FHT "in place" for slice of 4 doubles (the last codelet of recursion).
+	/// </summary>
+	/// <param name="slice">Double array slice.</param>
+	static void FhtCodelet(double* slice, integral_constant<int, 2>)
+	{
+		Fht4(slice);
+	} // end function FhtCodelet
+
+	/// <summary>
+	/// Performs reverse FHT "in place" for slice of 2^LengthLog2 doubles (codelet, see <see cref="FhtCodelet" />).
+	/// </summary>
+	/// <param name="slice">Double array slice.</param>
+	template <int LengthLog2>
+	static void ReverseFhtCodelet(double* slice, integral_constant<int, LengthLog2>)
+	{
+		const UInt32 length = 1U << (LengthLog2 - 1);
+
+		ReverseFhtCodelet(slice, integral_constant<int, LengthLog2 - 1>());
+		ReverseFhtCodelet(slice + length, integral_constant<int, LengthLog2 - 1>());
+		ReverseFhtCodeletButterflies<LengthLog2 - 1>(slice);
+	} // end function ReverseFhtCodelet
+
+	/// <summary>
+	/// Performs reverse FHT "in place" for slice of 8 doubles (the last codelet of recursion).
+	/// </summary>
+	/// <param name="slice">Double array slice.</param>
+	static void ReverseFhtCodelet(double* slice, integral_constant<int, 3>)
+	{
+		ReverseFht8(slice);
+	} // end function ReverseFhtCodelet
+
+	/// <summary>
+	/// Performs all "butterfly" operations of codelet recursion level for <see cref="Fht(double*, uint, int)" />
+	/// (same as <see cref="FhtButterflies" /> for all numbers). Part length is 2^LengthLog2.
+	/// </summary>
+	/// <param name="slice">Left part of data array slice (right part follows it).</param>
+	template <int LengthLog2>
+	static void FhtCodeletButterflies(double* slice)
+	{
+		const UInt32 length = 1U << LengthLog2, lengthDiv2 = length >> 1, lengthDiv4 = length >> 2;
+		double* rightSlice = slice + length;
+		const double* cosTable = TwiddleTables[LengthLog2].data();
+		const double* sinTable = cosTable + lengthDiv4 + 1;
+
+		// Initial "butterfly" operations
+		double leftDigit = slice[0];
+		double rightDigit = rightSlice[0];
+		slice[0] = leftDigit + rightDigit;
+		rightSlice[0] = leftDigit - rightDigit;
+
+		leftDigit = slice[lengthDiv2];
+		rightDigit = rightSlice[lengthDiv2];
+		slice[lengthDiv2] = leftDigit + rightDigit;
+		rightSlice[lengthDiv2] = leftDigit - rightDigit;
+
+		// Perform "butterfly"
+		UInt32 i = 1;
+#ifdef INTX_FHT_SIMD
+		if ((length << 1) >= Constants::FhtSimdLengthLowerBound && isSimdSupported)
+		{
+			i = FhtButterfliesAvx2(slice, rightSlice, length, LengthLog2, i, lengthDiv4);
+		} // end if
+#endif
+		for (; i < lengthDiv4; ++i)
+		{
+			FhtButterfly(slice, rightSlice, i, length - i, cosTable[i], sinTable[i]);
+			FhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sinTable[i], cosTable[i]);
+		} // end for
+
+		// Final "butterfly"
+		FhtButterfly(slice, rightSlice, lengthDiv4, length - lengthDiv4, Sqrt2Div2, Sqrt2Div2);
+	} // end function FhtCodeletButterflies
+
+	/// <summary>
+	/// Performs all "butterfly" operations of codelet recursion level for <see cref="ReverseFht(double*, uint, int)" />
+	/// (same as <see cref="ReverseFhtButterflies" /> for all numbers). Part length is 2^LengthLog2.
+	/// </summary>
+	/// <param name="slice">Left part of data array slice (right part follows it).</param>
+	template <int LengthLog2>
+	static void ReverseFhtCodeletButterflies(double* slice)
+	{
+		const UInt32 length = 1U << LengthLog2, lengthDiv2 = length >> 1, lengthDiv4 = length >> 2;
+		double* rightSlice = slice + length;
+		const double* cosTable = TwiddleTables[LengthLog2].data();
+		const double* sinTable = cosTable + lengthDiv4 + 1;
+
+		// Perform "butterfly"
+		UInt32 i = 1;
+#ifdef INTX_FHT_SIMD
+		if ((length << 1) >= Constants::FhtSimdLengthLowerBound && isSimdSupported)
+		{
+			i = ReverseFhtButterfliesAvx2(slice, rightSlice, length, LengthLog2, i, lengthDiv4);
+		} // end if
+#endif
+		for (; i < lengthDiv4; ++i)
+		{
+			ReverseFhtButterfly(slice, rightSlice, i, length - i, cosTable[i], sinTable[i]);
+			ReverseFhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sinTable[i], cosTable[i]);
+		} // end for
+
+		// Final and initial "butterflies"
+		ReverseFhtButterfly(slice, rightSlice, lengthDiv4, length - lengthDiv4, Sqrt2Div2, Sqrt2Div2);
+		ReverseFhtButterfly2(slice, rightSlice, 0, 0, 1.0, 0);
+		ReverseFhtButterfly2(slice, rightSlice, lengthDiv2, lengthDiv2, 0, 1.0);
+	} // end function ReverseFhtCodeletButterflies
+
+#ifdef INTX_FHT_SIMD
+	/// <summary>
+	/// Checks if CPU supports instructions used by SIMD kernels (AVX2 and FMA).
+	/// </summary>
+	/// <returns>True if SIMD kernels can be used.</returns>
+	static bool IsSimdSupported()
+	{
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+
+		// FMA, OSXSAVE and AVX flags; OS must also save YMM registers
+		__cpuid(info, 1);
+		const int flags = (1 << 12) | (1 << 27) | (1 << 28);
+		if ((info[2] & flags) != flags || (_xgetbv(0) & 6) != 6) return false;
+
+		// AVX2 flag
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+	} // end function IsSimdSupported
+
+	/// <summary>
+	/// Reverses order of vector values.
+	/// </summary>
+	/// <param name="value">Vector.</param>
+	/// <returns>Reversed vector.</returns>
+	INTX_TARGET_AVX2 static __m256d ReverseAvx2(const __m256d value)
+	{
+		return _mm256_permute4x64_pd(value, 0x1B);
+	} // end function ReverseAvx2
+
+	/// <summary>
+	/// Returns trigonometry values vectors for "butterflies" index..index+3 of FHT slice (see <see cref="GetTwiddle" />).
+	/// </summary>
+	/// <param name="lengthLog2">Log2(processing slice length), at least 2.</param>
+	/// <param name="index">Number of the first "butterfly" (multiple of 4).</param>
+	/// <param name="cos">Cos values vector.</param>
+	/// <param name="sin">Sin values vector.</param>
+	INTX_TARGET_AVX2 static void GetTwiddleVectorsAvx2(const int lengthLog2, const UInt32 index, __m256d &cos, __m256d &sin)
+	{
+		const vector<double> &table = TwiddleTables[lengthLog2];
+		UInt32 count = (UInt32)table.size() >> 1;
+		if (lengthLog2 <= Constants::FhtTwiddleTableLengthLog2)
+		{
+			cos = _mm256_loadu_pd(table.data() + index);
+			sin = _mm256_loadu_pd(table.data() + count + index);
+			return;
+		} // end if
+
+		// All 4 angles have the same coarse part
+		int shift = GetTwiddleShift(lengthLog2);
+		const vector<double> &coarseTable = TwiddleTables[lengthLog2 - shift];
+		UInt32 coarseIndex = index >> shift, fineIndex = index & (count - 1);
+		__m256d coarseCos = _mm256_set1_pd(coarseTable[coarseIndex]);
+		__m256d coarseSin = _mm256_set1_pd(coarseTable[(coarseTable.size() >> 1) + coarseIndex]);
+		__m256d fineCos = _mm256_loadu_pd(table.data() + fineIndex);
+		__m256d fineSin = _mm256_loadu_pd(table.data() + count + fineIndex);
+		cos = _mm256_fmsub_pd(coarseCos, fineCos, _mm256_mul_pd(coarseSin, fineSin));
+		sin = _mm256_fmadd_pd(coarseSin, fineCos, _mm256_mul_pd(coarseCos, fineSin));
+	} // end function GetTwiddleVectorsAvx2
+
+	/// <summary>
+	/// Performs 4 "butterfly" operations for <see cref="Fht(double*, uint, int)" />:
+	/// for indexes <paramref name="index1" /> + k and <paramref name="index2" /> - k.
+	/// </summary>
+	/// <param name="slice1">First data array slice.</param>
+	/// <param name="slice2">Second data array slice.</param>
+	/// <param name="index1">First slice index.</param>
+	/// <param name="index2">Second slice index.</param>
+	/// <param name="cos">Cos values.</param>
+	/// <param name="sin">Sin values.</param>
+	INTX_TARGET_AVX2 static void FhtButterflyAvx2(double* slice1, double* slice2, const UInt32 index1, const UInt32 index2,
+		const __m256d cos, const __m256d sin)
+	{
+		__m256d d11 = _mm256_loadu_pd(slice1 + index1);
+		__m256d d12 = ReverseAvx2(_mm256_loadu_pd(slice1 + index2 - 3));
+
+		__m256d temp = _mm256_loadu_pd(slice2 + index1);
+		_mm256_storeu_pd(slice1 + index1, _mm256_add_pd(d11, temp));
+		d11 = _mm256_sub_pd(d11, temp);
+
+		temp = ReverseAvx2(_mm256_loadu_pd(slice2 + index2 - 3));
+		_mm256_storeu_pd(slice1 + index2 - 3, ReverseAvx2(_mm256_add_pd(d12, temp)));
+		d12 = _mm256_sub_pd(d12, temp);
+
+		_mm256_storeu_pd(slice2 + index1, _mm256_fmadd_pd(d11, cos, _mm256_mul_pd(d12, sin)));
+		_mm256_storeu_pd(slice2 + index2 - 3, ReverseAvx2(_mm256_fmsub_pd(d11, sin, _mm256_mul_pd(d12, cos))));
+	} // end function FhtButterflyAvx2
+
+	/// <summary>
+	/// Performs 4 "butterfly" operations for <see cref="Fht(double*, uint, int)" /> when second slice values are zero:
+	/// for indexes <paramref name="index1" /> + k and <paramref name="index2" /> - k.
+	/// </summary>
+	/// <param name="slice1">First data array slice.</param>
+	/// <param name="slice2">Second data array slice.</param>
+	/// <param name="index1">First slice index.</param>
+	/// <param name="index2">Second slice index.</param>
+	/// <param name="cos">Cos values.</param>
+	/// <param name="sin">Sin values.</param>
+	INTX_TARGET_AVX2 static void ZeroRightFhtButterflyAvx2(const double* slice1, double* slice2, const UInt32 index1, const UInt32 index2,
+		const __m256d cos, const __m256d sin)
+	{
+		__m256d d11 = _mm256_loadu_pd(slice1 + index1);
+		__m256d d12 = ReverseAvx2(_mm256_loadu_pd(slice1 + index2 - 3));
+
+		_mm256_storeu_pd(slice2 + index1, _mm256_fmadd_pd(d11, cos, _mm256_mul_pd(d12, sin)));
+		_mm256_storeu_pd(slice2 + index2 - 3, ReverseAvx2(_mm256_fmsub_pd(d11, sin, _mm256_mul_pd(d12, cos))));
+	} // end function ZeroRightFhtButterflyAvx2
+
+	/// <summary>
+	/// Performs 4 "butterfly" operations for <see cref="ReverseFht(double*, uint, int)" />:
+	/// for indexes <paramref name="index1" /> + k and <paramref name="index2" /> - k.
+	/// </summary>
+	/// <param name="slice1">First data array slice.</param>
+	/// <param name="slice2">Second data array slice.</param>
+	/// <param name="index1">First slice index.</param>
+	/// <param name="index2">Second slice index.</param>
+	/// <param name="cos">Cos values.</param>
+	/// <param name="sin">Sin values.</param>
+	INTX_TARGET_AVX2 static void ReverseFhtButterflyAvx2(double* slice1, double* slice2, const UInt32 index1, const UInt32 index2,
+		const __m256d cos, const __m256d sin)
+	{
+		__m256d d21 = _mm256_loadu_pd(slice2 + index1);
+		__m256d d22 = ReverseAvx2(_mm256_loadu_pd(slice2 + index2 - 3));
+
+		__m256d temp = _mm256_loadu_pd(slice1 + index1);
+		__m256d temp2 = _mm256_fmadd_pd(d21, cos, _mm256_mul_pd(d22, sin));
+		_mm256_storeu_pd(slice1 + index1, _mm256_add_pd(temp, temp2));
+		_mm256_storeu_pd(slice2 + index1, _mm256_sub_pd(temp, temp2));
+
+		temp = ReverseAvx2(_mm256_loadu_pd(slice1 + index2 - 3));
+		temp2 = _mm256_fmsub_pd(d21, sin, _mm256_mul_pd(d22, cos));
+		_mm256_storeu_pd(slice1 + index2 - 3, ReverseAvx2(_mm256_add_pd(temp, temp2)));
+		_mm256_storeu_pd(slice2 + index2 - 3, ReverseAvx2(_mm256_sub_pd(temp, temp2)));
+	} // end function ReverseFhtButterflyAvx2
+
+	/// <summary>
+	/// Performs usual "butterfly" operations with given numbers for <see cref="Fht(double*, uint, int)" />
+	/// by 4 at once; vectors start from multiple of 4 and previous operations are scalar.
+	/// </summary>
+	/// <param name="slice">Left part of data array slice.</param>
+	/// <param name="rightSlice">Right part of data array slice.</param>
+	/// <param name="length">Part length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	/// <param name="begin">First "butterfly" number (at least 1).</param>
+	/// <param name="end">Number after the last "butterfly" (at most lengthDiv4).</param>
+	/// <returns>Number of the first "butterfly" which is not done (if it's not a whole vector).</returns>
+	INTX_TARGET_AVX2 static UInt32 FhtButterfliesAvx2(double* slice, double* rightSlice, const UInt32 length, const int lengthLog2,
+		const UInt32 begin, const UInt32 end)
+	{
+		UInt32 lengthDiv2 = length >> 1;
+		UInt32 vectorBegin = begin < 4 ? 4 : (begin + 3) & ~3U;
+		if (vectorBegin + 4 > end) return begin;
+
+		UInt32 i = begin;
+		double cos, sin;
+		for (; i < vectorBegin; ++i)
+		{
+			GetTwiddle(lengthLog2, i, cos, sin);
+			FhtButterfly(slice, rightSlice, i, length - i, cos, sin);
+			FhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sin, cos);
+		} // end for
+
+		__m256d cosVector, sinVector;
+		for (; i + 4 <= end; i += 4)
+		{
+			// Second butterflies go in reverse order, so vectors are reversed for them
+			GetTwiddleVectorsAvx2(lengthLog2, i, cosVector, sinVector);
+			FhtButterflyAvx2(slice, rightSlice, i, length - i, cosVector, sinVector);
+			FhtButterflyAvx2(slice, rightSlice, lengthDiv2 - i - 3, lengthDiv2 + i + 3, ReverseAvx2(sinVector), ReverseAvx2(cosVector));
+		} // end for
+		return i;
+	} // end function FhtButterfliesAvx2
+
+	/// <summary>
+	/// Performs usual "butterfly" operations with given numbers for <see cref="ZeroRightFhtButterflies" />
+	/// by 4 at once; vectors start from multiple of 4 and previous operations are scalar.
+	/// </summary>
+	/// <param name="slice">Left part of data array slice.</param>
+	/// <param name="rightSlice">Right part of data array slice.</param>
+	/// <param name="length">Part length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	/// <param name="begin">First "butterfly" number (at least 1).</param>
+	/// <param name="end">Number after the last "butterfly" (at most lengthDiv4).</param>
+	/// <returns>Number of the first "butterfly" which is not done (if it's not a whole vector).</returns>
+	INTX_TARGET_AVX2 static UInt32 ZeroRightFhtButterfliesAvx2(const double* slice, double* rightSlice, const UInt32 length,
+		const int lengthLog2, const UInt32 begin, const UInt32 end)
+	{
+		UInt32 lengthDiv2 = length >> 1;
+		UInt32 vectorBegin = begin < 4 ? 4 : (begin + 3) & ~3U;
+		if (vectorBegin + 4 > end) return begin;
+
+		UInt32 i = begin;
+		double cos, sin;
+		for (; i < vectorBegin; ++i)
+		{
+			GetTwiddle(lengthLog2, i, cos, sin);
+			ZeroRightFhtButterfly(slice, rightSlice, i, length - i, cos, sin);
+			ZeroRightFhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sin, cos);
+		} // end for
+
+		__m256d cosVector, sinVector;
+		for (; i + 4 <= end; i += 4)
+		{
+			// Second butterflies go in reverse order, so vectors are reversed for them
+			GetTwiddleVectorsAvx2(lengthLog2, i, cosVector, sinVector);
+			ZeroRightFhtButterflyAvx2(slice, rightSlice, i, length - i, cosVector, sinVector);
+			ZeroRightFhtButterflyAvx2(slice, rightSlice, lengthDiv2 - i - 3, lengthDiv2 + i + 3, ReverseAvx2(sinVector), ReverseAvx2(cosVector));
+		} // end for
+		return i;
+	} // end function ZeroRightFhtButterfliesAvx2
+
+	/// <summary>
+	/// Performs usual "butterfly" operations with given numbers for <see cref="ReverseFht(double*, uint, int)" />
+	/// by 4 at once; vectors start from multiple of 4 and previous operations are scalar.
+	/// </summary>
+	/// <param name="slice">Left part of data array slice.</param>
+	/// <param name="rightSlice">Right part of data array slice.</param>
+	/// <param name="length">Part length.</param>
+	/// <param name="lengthLog2">Log2(<paramref name="length" />).</param>
+	/// <param name="begin">First "butterfly" number (at least 1).</param>
+	/// <param name="end">Number after the last "butterfly" (at most lengthDiv4).</param>
+	/// <returns>Number of the first "butterfly" which is not done (if it's not a whole vector).</returns>
+	INTX_TARGET_AVX2 static UInt32 ReverseFhtButterfliesAvx2(double* slice, double* rightSlice, const UInt32 length, const int lengthLog2,
+		const UInt32 begin, const UInt32 end)
+	{
+		UInt32 lengthDiv2 = length >> 1;
+		UInt32 vectorBegin = begin < 4 ? 4 : (begin + 3) & ~3U;
+		if (vectorBegin + 4 > end) return begin;
+
+		UInt32 i = begin;
+		double cos, sin;
+		for (; i < vectorBegin; ++i)
+		{
+			GetTwiddle(lengthLog2, i, cos, sin);
+			ReverseFhtButterfly(slice, rightSlice, i, length - i, cos, sin);
+			ReverseFhtButterfly(slice, rightSlice, lengthDiv2 - i, lengthDiv2 + i, sin, cos);
+		} // end for
+
+		__m256d cosVector, sinVector;
+		for (; i + 4 <= end; i += 4)
+		{
+			// Second butterflies go in reverse order, so vectors are reversed for them
+			GetTwiddleVectorsAvx2(lengthLog2, i, cosVector, sinVector);
+			ReverseFhtButterflyAvx2(slice, rightSlice, i, length - i, cosVector, sinVector);
+			ReverseFhtButterflyAvx2(slice, rightSlice, lengthDiv2 - i - 3, lengthDiv2 + i + 3, ReverseAvx2(sinVector), ReverseAvx2(cosVector));
+		} // end for
+		return i;
+	} // end function ReverseFhtButterfliesAvx2
+
+	/// <summary>
+	/// Performs one step of <see cref="MultiplyFhtResults" /> by vectors.
+	/// Pairs of values are taken from blocks of 8 values at both step ends: even values of one block
+	/// are paired with odd values of another one (in reverse order).
 	/// </summary>
-	/// <param name="sineTable">Sine table to fill.</param>
-	static void FillSineTable(vector<double> &sineTable)
+	/// <param name="slice">First FHT result.</param>
+	/// <param name="slice2">Second FHT result.</param>
+	/// <param name="stepStart">Step start index (at least 16).</param>
+	/// <param name="stepEnd">Step end index.</param>
+	/// <param name="begin">First block of the lower half of step (multiple of 8).</param>
+	/// <param name="end">Block after the last one (multiple of 8).</param>
+	INTX_TARGET_AVX2 static void MultiplyFhtStepAvx2(double* slice, const double* slice2, const UInt32 stepStart, const UInt32 stepEnd,
+		const UInt32 begin, const UInt32 end)
 	{
-		for (int i = 0, p = 1; i < 31; ++i, p *= 2)
+		for (UInt32 low = begin, high = stepStart + stepEnd - 8 - begin; low < end; low += 8, high -= 8)
 		{
-			sineTable[i] = sin(Constants::PI / double(p));
+			__m256d even1[2], odd1[2], even2[2], odd2[2];
+			UInt32 blocks[2] = { low, high };
+			for (int j = 0; j < 2; ++j)
+			{
+				// Split block into even and odd values
+				__m256d a = _mm256_loadu_pd(slice + blocks[j]);
+				__m256d b = _mm256_loadu_pd(slice + blocks[j] + 4);
+				even1[j] = _mm256_permute4x64_pd(_mm256_unpacklo_pd(a, b), 0xD8);
+				odd1[j] = _mm256_permute4x64_pd(_mm256_unpackhi_pd(a, b), 0xD8);
+
+				a = _mm256_loadu_pd(slice2 + blocks[j]);
+				b = _mm256_loadu_pd(slice2 + blocks[j] + 4);
+				even2[j] = _mm256_permute4x64_pd(_mm256_unpacklo_pd(a, b), 0xD8);
+				odd2[j] = _mm256_permute4x64_pd(_mm256_unpackhi_pd(a, b), 0xD8);
+			} // end for
+
+			for (int j = 0; j < 2; ++j)
+			{
+				__m256d d11 = even1[j];
+				__m256d d12 = ReverseAvx2(odd1[1 - j]);
+				__m256d d21 = even2[j];
+				__m256d d22 = ReverseAvx2(odd2[1 - j]);
+
+				__m256d ad = _mm256_add_pd(d11, d12);
+				__m256d sd = _mm256_sub_pd(d11, d12);
+
+				even1[j] = _mm256_fmadd_pd(d21, ad, _mm256_mul_pd(d22, sd));
+				odd1[1 - j] = ReverseAvx2(_mm256_fmsub_pd(d22, ad, _mm256_mul_pd(d21, sd)));
+			} // end for
+
+			for (int j = 0; j < 2; ++j)
+			{
+				// Merge even and odd values back
+				__m256d even = _mm256_permute4x64_pd(even1[j], 0xD8);
+				__m256d odd = _mm256_permute4x64_pd(odd1[j], 0xD8);
+				_mm256_storeu_pd(slice + blocks[j], _mm256_unpacklo_pd(even, odd));
+				_mm256_storeu_pd(slice + blocks[j] + 4, _mm256_unpackhi_pd(even, odd));
+			} // end for
 		} // end for
-	} // end function FillSineTable
+	} // end function MultiplyFhtStepAvx2
+#endif
+
+	/// <summary>
+	/// Rounds real digit to the nearest integer without branches: half is added with the sign of digit
+	/// and the sum is truncated.
+	/// </summary>
+	/// <param name="dataDigit">Real digit.</param>
+	/// <param name="maxRoundingError">Maximal distance between real digit and its rounded value (updated).</param>
+	/// <returns>Rounded digit.</returns>
+	static long long RoundDataDigit(const double dataDigit, double &maxRoundingError)
+	{
+		long long dataDigitInt = (long long)(dataDigit + copysign(0.5, dataDigit));
+		double roundingError = fabs(dataDigit - (double)dataDigitInt);
+		maxRoundingError = roundingError > maxRoundingError ? roundingError : maxRoundingError;
+		return dataDigitInt;
+	} // end function RoundDataDigit
 
 	/// <summary>
-	/// Initializes trigonometry values for FHT.
+	/// Returns maximal count of bits which can be stored in each double for FHT of given length.
+	/// Rounding error of FHT multiplication is the biggest when all digits are maximal by absolute value:
+	/// it's about length * 2^(2 * bits - 2) * 2^-53 * c, where c grows as sqrt(length). Bits are chosen so that
+	/// this error is at most 1/8, with c = max(2^3, 2^(lengthLog2 / 2 - 4.5)) (it was measured for trigonometry
+	/// values got by recurrence; values from tables, see <see cref="GetTwiddle" />, are more precise).
 	/// </summary>
-	/// <param name="valuesPtr">Values to init.</param>
-	/// <param name="lengthLog2">Log2(processing slice length).</param>
-	static void GetInitialTrigValues(TrigValues &valuesPtr, const int lengthLog2)
+	/// <param name="lengthLog2">Log2(transform length).</param>
+	/// <returns>Count of bits per double.</returns>
+	static int GetMaxDoubleDataBits(const int lengthLog2)
 	{
-		if (!FhtHelper::isSineTableInitialized)
+		double cLog2 = lengthLog2 / 2.0 - 4.5;
+		if (cLog2 < 3.0)
 		{
-			Init();
-			FhtHelper::isSineTableInitialized = true;
+			cLog2 = 3.0;
 		} // end if
 
-		valuesPtr.TableSin = SineTable[lengthLog2];
-		valuesPtr.TableCos = SineTable[lengthLog2 + 1];
-		valuesPtr.TableCos *= -2.0 * valuesPtr.TableCos;
+		// lengthLog2 + 2 * bits - 2 - 53 + cLog2 <= -3
+		int bits = (int)floor((52.0 - lengthLog2 - cLog2) / 2.0);
+		return bits < MinDoubleDataBits ? MinDoubleDataBits : bits > MaxDoubleDataBits ? MaxDoubleDataBits : bits;
+	} // end function GetMaxDoubleDataBits
+
+	/// <summary>
+	/// Returns log2 of count of fine angles in twiddle table of long FHT part (see <see cref="GetTwiddle" />).
+	/// </summary>
+	/// <param name="lengthLog2">Log2(processing slice length), more than <see cref="Constants::FhtTwiddleTableLengthLog2" />.</param>
+	/// <returns>Log2(fine angle count), at least 2 (so vectors of 4 "butterflies" have the same coarse angle).</returns>
+	static int GetTwiddleShift(const int lengthLog2)
+	{
+		int shift = lengthLog2 - Constants::FhtTwiddleTableLengthLog2;
+		return shift < 2 ? 2 : shift;
+	} // end function GetTwiddleShift
+
+	/// <summary>
+	/// Calculates twiddle tables (see <see cref="TwiddleTables" />).
+	/// </summary>
+	/// <returns>Tables for each log2(processing slice length).</returns>
+	static vector<vector<double> > GetTwiddleTables()
+	{
+		vector<vector<double> > tables(31);
+
+		// The longest full table is calculated directly, shorter ones take each 2^k-th angle of it
+		int maxLengthLog2 = Constants::FhtTwiddleTableLengthLog2;
+		UInt32 maxCount = (1U << (maxLengthLog2 - 2)) + 1;
+		vector<double> &maxTable = tables[maxLengthLog2];
+		maxTable.resize(2 * maxCount);
+		for (UInt32 i = 0; i < maxCount; ++i)
+		{
+			double angle = ldexp(Constants::PI * i, -maxLengthLog2);
+			maxTable[i] = cos(angle);
+			maxTable[maxCount + i] = sin(angle);
+		} // end for
+
+		for (int lengthLog2 = 2; lengthLog2 < maxLengthLog2; ++lengthLog2)
+		{
+			UInt32 count = (1U << (lengthLog2 - 2)) + 1, step = 1U << (maxLengthLog2 - lengthLog2);
+			tables[lengthLog2].resize(2 * count);
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				tables[lengthLog2][i] = maxTable[i * step];
+				tables[lengthLog2][count + i] = maxTable[maxCount + i * step];
+			} // end for
+		} // end for
+
+		// Longer slices have fine angles only
+		for (int lengthLog2 = maxLengthLog2 + 1; lengthLog2 < (int)tables.size(); ++lengthLog2)
+		{
+			UInt32 count = 1U << GetTwiddleShift(lengthLog2);
+			tables[lengthLog2].resize(2 * count);
+			for (UInt32 i = 0; i < count; ++i)
+			{
+				double angle = ldexp(Constants::PI * i, -lengthLog2);
+				tables[lengthLog2][i] = cos(angle);
+				tables[lengthLog2][count + i] = sin(angle);
+			} // end for
+		} // end for
 
-		valuesPtr.Sin = valuesPtr.TableSin;
-		valuesPtr.Cos = valuesPtr.TableCos + 1.0;
-	} // end function GetInitialTrigValues
+		return tables;
+	} // end function GetTwiddleTables
 
 	/// <summary>
-	/// Generates next trigonometry values for FHT basing on previous ones.
+	/// Returns trigonometry values for FHT "butterfly" with given number: angle is PI * index / 2^lengthLog2.
+	/// Values are taken from <see cref="TwiddleTables" />: for long slices angle is split into coarse part
+	/// (from the table of shorter slice) and fine one, and their values are combined.
 	/// </summary>
-	/// <param name="valuesPtr">Current trig values.</param>
-	static void NextTrigValues(TrigValues &valuesPtr)
+	/// <param name="lengthLog2">Log2(processing slice length), at least 2.</param>
+	/// <param name="index">"Butterfly" number (at most lengthDiv4).</param>
+	/// <param name="cos">Cos value.</param>
+	/// <param name="sin">Sin value.</param>
+	static void GetTwiddle(const int lengthLog2, const UInt32 index, double &cos, double &sin)
 	{
-		double oldCos = valuesPtr.Cos;
-		valuesPtr.Cos = valuesPtr.Cos * valuesPtr.TableCos - valuesPtr.Sin * valuesPtr.TableSin + valuesPtr.Cos;
-		valuesPtr.Sin = valuesPtr.Sin * valuesPtr.TableCos + oldCos * valuesPtr.TableSin + valuesPtr.Sin;
-	} // end function NextTrigValues
+		const vector<double> &table = TwiddleTables[lengthLog2];
+		UInt32 count = (UInt32)table.size() >> 1;
+		if (lengthLog2 <= Constants::FhtTwiddleTableLengthLog2)
+		{
+			cos = table[index];
+			sin = table[count + index];
+			return;
+		} // end if
+
+		int shift = GetTwiddleShift(lengthLog2);
+		const vector<double> &coarseTable = TwiddleTables[lengthLog2 - shift];
+		UInt32 coarseIndex = index >> shift, fineIndex = index & (count - 1);
+		double coarseCos = coarseTable[coarseIndex], coarseSin = coarseTable[(coarseTable.size() >> 1) + coarseIndex];
+		cos = coarseCos * table[fineIndex] - coarseSin * table[count + fineIndex];
+		sin = coarseSin * table[fineIndex] + coarseCos * table[count + fineIndex];
+	} // end function GetTwiddle
 
 }; // end class FhtHelper
 
@@ -12,6 +12,7 @@ typedef unsigned int UInt32;
 #include "Bits.h"
 #include "DigitOpHelper.h"
 #include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
 #include "../Multipliers/IMultiplier.h"
 #include "../Multipliers/MultiplyManager.h"
 
@@ -33,8 +34,8 @@ public:
 	/// <param name="bufferPtr">Buffer in which shifted big integer may be stored.</param>
 	/// <param name="newLength">Resulting big integer length.</param>
 	/// <param name="rightShift">How much resulting big integer is shifted to the left (or: must be shifted to the right).</param>
-	/// <returns>Resulting big integer digits.</returns>
-	static vector<UInt32> GetIntegerOpposite(
+	/// <returns>Resulting big integer digits (taken from pool).</returns>
+	static PooledArray<UInt32> GetIntegerOpposite(
 		const UInt32* digitsPtr,
 		const UInt32 vlength,
 		const UInt32 maxLength,
@@ -67,22 +68,22 @@ public:
 		int lengthLog2Bits = lengthLog2 + Bits::Msb(Constants::DigitBitCount);
 
 		// Create result digits
-		vector<UInt32> resultDigits(newLengthMax);
+		PooledArray<UInt32> resultDigits(newLengthMax);
 		UInt32 resultLength;
 
 		// Create temporary digits for squared result (twice more size)
-		vector<UInt32> resultDigitsSqr(newLengthMax);
+		PooledArray<UInt32> resultDigitsSqr(newLengthMax);
 		UInt32 resultLengthSqr;
 
 		// Create temporary digits for squared result * buffer
-		vector<UInt32> resultDigitsSqrBuf(newLengthMax + length);
+		PooledArray<UInt32> resultDigitsSqrBuf(newLengthMax + length);
 		UInt32 resultLengthSqrBuf;
 
 		// We will always use current multiplier
 		IMultiplier *multiplier = MultiplyManager::GetCurrentMultiplier();
 
 		// Fix some digits
-		UInt32* resultPtrFixed = &resultDigits[0], *resultSqrPtrFixed = &resultDigitsSqr[0], *resultSqrBufPtr = &resultDigitsSqrBuf[0];
+		UInt32* resultPtrFixed = resultDigits.data(), *resultSqrPtrFixed = resultDigitsSqr.data(), *resultSqrBufPtr = resultDigitsSqrBuf.data();
 
 		UInt32* resultPtr = resultPtrFixed;
 		UInt32* resultSqrPtr = resultSqrPtrFixed;
@@ -116,12 +117,7 @@ public:
 		for (int k = 0; k < lengthLog2Bits; ++k)
 		{
 			// Get result squared
-			resultLengthSqr = multiplier->Multiply(
-				resultPtr,
-				resultLength,
-				resultPtr,
-				resultLength,
-				resultSqrPtr);
+			resultLengthSqr = multiplier->Sqr(resultPtr, resultLength, resultSqrPtr);
 
 			// Calculate current result bits after dot
 			bitsAfterDotResult = (1UL << k) + 1UL;
@@ -180,9 +176,7 @@ public:
 			resultPtr = resultSqrPtr;
 			resultSqrPtr = tempPtr;
 
-			vector<UInt32> tempDigits = resultDigits;
-			resultDigits = resultDigitsSqr;
-			resultDigitsSqr = tempDigits;
+			resultDigits.swap(resultDigitsSqr);
 
 			DigitHelper::SetBlockDigits(resultPtr, shiftOffset, 0U);
 
@@ -0,0 +1,17 @@
+#include "stdafx.h"
+#include "NttHelper.h"
+
+// Initialize static variable
+const NttHelper::NttPrime NttHelper::Primes[NttHelper::PrimeCount] =
+{
+	// Modulus, Generator, NegInverse, R2
+	{ 0x3FFFC00000000001ULL, 11, 0x3FFFBFFFFFFFFFFFULL, 0x3FF8BFFBFFFC000DULL },
+	{ 0x3FFFBE0000000001ULL, 3, 0x3FFFBDFFFFFFFFFFULL, 0x2180D7FBBEFB9D04ULL },
+	{ 0x3FFF840000000001ULL, 19, 0x3FFF83FFFFFFFFFFULL, 0x178C9FF0FBE2E818ULL }
+};
+
+const UInt64 NttHelper::InvP0ModP1 = 0x0000000000800000ULL;
+const UInt64 NttHelper::P0ModP2 = 0x346637FE2EFC7B0AULL;
+const UInt64 NttHelper::InvP0P1ModP2 = 0x11A797276E1611A8ULL;
+const UInt64 NttHelper::P0P1Low = 0x7FFF7E0000000001ULL;
+const UInt64 NttHelper::P0P1High = 0x0FFFDF8010800000ULL;
@@ -0,0 +1,359 @@
+#pragma once
+
+#ifndef NTTHELPER_H
+#define NTTHELPER_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include "DigitHelper.h"
+#include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
+
+using namespace std;
+
+// Number-theoretic transform (NTT) over three 62-bit primes p = k * 2^40 + 1.
+// Every two <see cref="IntX" /> digits form one 64-bit transform item, so convolution items are less than
+// 2^30 * 2^128 = 2^158 and they are restored exactly from three residues (p0 * p1 * p2 > 2^185) using CRT.
+// All modular products are done in Montgomery form (R = 2^64).
+class NttHelper
+{
+public:
+
+	// Count of primes (and transforms of each operand).
+	static const int PrimeCount = 3;
+
+	// Transform length can't exceed 2^MaxLengthLog2 for any prime.
+	static const int MaxLengthLog2 = 40;
+
+	// NTT prime with its Montgomery constants.
+	struct NttPrime
+	{
+		// Prime modulus p.
+		UInt64 Modulus;
+
+		// Primitive root modulo p.
+		UInt64 Generator;
+
+		// -1 / p modulo 2^64.
+		UInt64 NegInverse;
+
+		// 2^128 modulo p (used to convert value into Montgomery form).
+		UInt64 R2;
+	}; // end struct NttPrime
+
+	// Primes used by transform.
+	static const NttPrime Primes[PrimeCount];
+
+	/// <summary>
+	/// Returns transform length needed to multiply big integers with given lengths.
+	/// </summary>
+	/// <param name="length1">First big integer length.</param>
+	/// <param name="length2">Second big integer length.</param>
+	/// <returns>Transform length (pow of 2).</returns>
+	static UInt32 GetTransformLength(const UInt32 length1, const UInt32 length2)
+	{
+		UInt32 itemCount = (length1 + 1) / 2 + (length2 + 1) / 2 - 1;
+		return itemCount <= 1 ? 1U : 1U << Bits::CeilLog2(itemCount);
+	} // end function GetTransformLength
+
+	/// <summary>
+	/// Fills twiddle factors table for transform of given length.
+	/// For each stage length <c>len</c> roots of unity w^j of order 2 * len are stored starting from index len.
+	/// </summary>
+	/// <param name="twiddles">Table to fill (<paramref name="length" /> items, first one is unused).</param>
+	/// <param name="length">Transform length (pow of 2).</param>
+	/// <param name="prime">Prime to use.</param>
+	static void FillTwiddles(UInt64 *twiddles, const UInt32 length, const NttPrime &prime)
+	{
+		if (length < 2) return;
+
+		UInt32 halfLength = length >> 1;
+		UInt64 root = Pow(ToMontgomery(prime.Generator, prime), (prime.Modulus - 1) / length, prime);
+
+		// The biggest stage is filled by powers of the root and each next one takes every second of them
+		twiddles[halfLength] = ToMontgomery(1, prime);
+		for (UInt32 j = 1; j < halfLength; ++j)
+		{
+			twiddles[halfLength + j] = MulMod(twiddles[halfLength + j - 1], root, prime);
+		} // end for
+		for (UInt32 stageLength = halfLength >> 1; stageLength > 0; stageLength >>= 1)
+		{
+			for (UInt32 j = 0; j < stageLength; ++j)
+			{
+				twiddles[stageLength + j] = twiddles[2 * stageLength + 2 * j];
+			} // end for
+		} // end for
+	} // end function FillTwiddles
+
+	/// <summary>
+	/// Converts <see cref="IntX" /> digits into transform items (residues in Montgomery form).
+	/// </summary>
+	/// <param name="digitsPtr">Big integer digits.</param>
+	/// <param name="length"><paramref name="digitsPtr" /> length.</param>
+	/// <param name="data">Transform data.</param>
+	/// <param name="dataLength">Transform length.</param>
+	/// <param name="prime">Prime to use.</param>
+	static void ConvertDigitsToResidues(const UInt32 *digitsPtr, const UInt32 length, UInt64 *data, const UInt32 dataLength, const NttPrime &prime)
+	{
+		UInt32 itemCount = length / 2;
+		for (UInt32 i = 0; i < itemCount; ++i)
+		{
+			data[i] = ToMontgomery(digitsPtr[2 * i] | (UInt64)digitsPtr[2 * i + 1] << 32, prime);
+		} // end for
+		if ((length & 1) != 0)
+		{
+			data[itemCount++] = ToMontgomery(digitsPtr[length - 1], prime);
+		} // end if
+
+		// Clear remaining items (this array is from pool and may be dirty)
+		memset(data + itemCount, 0, (dataLength - itemCount) * sizeof(UInt64));
+	} // end function ConvertDigitsToResidues
+
+	/// <summary>
+	/// Performs NTT "in place" (decimation in frequency, items are returned in bit-reversed order).
+	/// </summary>
+	/// <param name="data">Transform data.</param>
+	/// <param name="length">Transform length (pow of 2).</param>
+	/// <param name="twiddles">Twiddle factors table (see <see cref="FillTwiddles" />).</param>
+	/// <param name="prime">Prime to use.</param>
+	static void Ntt(UInt64 *data, const UInt32 length, const UInt64 *twiddles, const NttPrime &prime)
+	{
+		UInt64 modulus = prime.Modulus;
+		for (UInt32 stageLength = length >> 1; stageLength > 0; stageLength >>= 1)
+		{
+			const UInt64 *stageTwiddles = twiddles + stageLength;
+			for (UInt64 *left = data, *end = data + length; left < end; left += 2 * stageLength)
+			{
+				UInt64 *right = left + stageLength;
+				for (UInt32 j = 0; j < stageLength; ++j)
+				{
+					UInt64 u = left[j];
+					UInt64 v = right[j];
+					left[j] = AddMod(u, v, modulus);
+					right[j] = MulMod(SubMod(u, v, modulus), stageTwiddles[j], prime);
+				} // end for
+			} // end for
+		} // end for
+	} // end function Ntt
+
+	/// <summary>
+	/// Performs reverse NTT "in place" (decimation in time, items are expected in bit-reversed order).
+	/// Result isn't divided by <paramref name="length" /> (it's done in <see cref="ConvertResiduesToDigits" />).
+	/// </summary>
+	/// <param name="data">Transform data.</param>
+	/// <param name="length">Transform length (pow of 2).</param>
+	/// <param name="twiddles">Twiddle factors table used for direct transform.</param>
+	/// <param name="prime">Prime to use.</param>
+	static void ReverseNtt(UInt64 *data, const UInt32 length, const UInt64 *twiddles, const NttPrime &prime)
+	{
+		UInt64 modulus = prime.Modulus;
+		for (UInt32 stageLength = 1; stageLength < length; stageLength <<= 1)
+		{
+			// w^-j == -w^(stageLength - j) for the roots of order 2 * stageLength
+			const UInt64 *stageTwiddles = twiddles + 2 * stageLength;
+			for (UInt64 *left = data, *end = data + length; left < end; left += 2 * stageLength)
+			{
+				UInt64 *right = left + stageLength;
+				UInt64 u = left[0];
+				UInt64 v = right[0];
+				left[0] = AddMod(u, v, modulus);
+				right[0] = SubMod(u, v, modulus);
+				for (UInt32 j = 1; j < stageLength; ++j)
+				{
+					u = left[j];
+					v = MulMod(right[j], stageTwiddles[-(int)j], prime);
+					left[j] = SubMod(u, v, modulus);
+					right[j] = AddMod(u, v, modulus);
+				} // end for
+			} // end for
+		} // end for
+	} // end function ReverseNtt
+
+	/// <summary>
+	/// Multiplies two NTT results and stores multiplication in first one.
+	/// </summary>
+	/// <param name="data1">First NTT result.</param>
+	/// <param name="data2">Second NTT result.</param>
+	/// <param name="length">NTT results length.</param>
+	/// <param name="prime">Prime to use.</param>
+	static void MultiplyNttResults(UInt64 *data1, const UInt64 *data2, const UInt32 length, const NttPrime &prime)
+	{
+		for (UInt32 i = 0; i < length; ++i)
+		{
+			data1[i] = MulMod(data1[i], data2[i], prime);
+		} // end for
+	} // end function MultiplyNttResults
+
+	/// <summary>
+	/// Restores convolution items from their residues (modulo each prime) and converts them into
+	/// usual <see cref="IntX" /> digits.
+	/// </summary>
+	/// <param name="residues">Reverse NTT results for each prime (not divided by transform length yet).</param>
+	/// <param name="length">Transform length.</param>
+	/// <param name="digitsLength">Resulting digits count (we always do know the upper value for it).</param>
+	/// <param name="digitsResPtr">Resulting digits storage.</param>
+	static void ConvertResiduesToDigits(UInt64 *const residues[PrimeCount], const UInt32 length, const UInt32 digitsLength, UInt32 *digitsResPtr)
+	{
+		const NttPrime &prime0 = Primes[0], &prime1 = Primes[1], &prime2 = Primes[2];
+
+		// 1 / length (it's -(p - 1) / length since length divides p - 1)
+		UInt64 scale0 = prime0.Modulus - (prime0.Modulus - 1) / length;
+		UInt64 scale1 = prime1.Modulus - (prime1.Modulus - 1) / length;
+		UInt64 scale2 = prime2.Modulus - (prime2.Modulus - 1) / length;
+
+		// Carry is less than 2^(158 - 64 + 1), so two words are enough
+		UInt64 carry0 = 0, carry1 = 0;
+		for (UInt32 i = 0, digitIndex = 0; digitIndex < digitsLength; ++i, digitIndex += 2)
+		{
+			UInt64 x0 = 0, x1 = 0, x2 = 0;
+			if (i < length)
+			{
+				// Scaled residues (multiplication by plain value takes them out of Montgomery form)
+				UInt64 r0 = MulMod(residues[0][i], scale0, prime0);
+				UInt64 r1 = MulMod(residues[1][i], scale1, prime1);
+				UInt64 r2 = MulMod(residues[2][i], scale2, prime2);
+
+				// Garner's algorithm: x = v0 + v1 * p0 + v2 * p0 * p1
+				UInt64 v0 = r0;
+				UInt64 v1 = MulMod(SubMod(r1, Reduce(v0, prime1.Modulus), prime1.Modulus), InvP0ModP1, prime1);
+				UInt64 v2 = SubMod(r2, Reduce(v0, prime2.Modulus), prime2.Modulus);
+				v2 = SubMod(v2, MulMod(v1, P0ModP2, prime2), prime2.Modulus);
+				v2 = MulMod(v2, InvP0P1ModP2, prime2);
+
+				UInt64 high;
+				x0 = MulWide(v1, prime0.Modulus, x1);
+				x0 += v0;
+				x1 += x0 < v0 ? 1 : 0;
+
+				UInt64 low = MulWide(v2, P0P1Low, high);
+				x0 += low;
+				high += x0 < low ? 1 : 0;
+				x1 += high;
+				x2 = x1 < high ? 1 : 0;
+
+				low = MulWide(v2, P0P1High, high);
+				x1 += low;
+				x2 += high + (x1 < low ? 1 : 0);
+			} // end if
+
+			// Add carry and store lower word
+			x0 += carry0;
+			UInt64 overflow = x0 < carry0 ? 1 : 0;
+			x1 += overflow;
+			x2 += x1 < overflow ? 1 : 0;
+			x1 += carry1;
+			x2 += x1 < carry1 ? 1 : 0;
+
+			digitsResPtr[digitIndex] = (UInt32)x0;
+			if (digitIndex + 1 < digitsLength)
+			{
+				digitsResPtr[digitIndex + 1] = (UInt32)(x0 >> 32);
+			} // end if
+
+			carry0 = x1;
+			carry1 = x2;
+		} // end for
+	} // end function ConvertResiduesToDigits
+
+private:
+
+	// CRT constants (in Montgomery form where needed)
+	static const UInt64 InvP0ModP1; // 1 / p0 modulo p1
+	static const UInt64 P0ModP2; // p0 modulo p2
+	static const UInt64 InvP0P1ModP2; // 1 / (p0 * p1) modulo p2
+	static const UInt64 P0P1Low; // lower word of p0 * p1
+	static const UInt64 P0P1High; // higher word of p0 * p1
+
+	/// <summary>
+	/// Multiplies two 64-bit values.
+	/// </summary>
+	/// <param name="a">First value.</param>
+	/// <param name="b">Second value.</param>
+	/// <param name="high">Higher word of the product.</param>
+	/// <returns>Lower word of the product.</returns>
+	static UInt64 MulWide(const UInt64 a, const UInt64 b, UInt64 &high)
+	{
+#ifdef INTX_64BIT_KERNELS
+		UInt128 product = (UInt128)a * b;
+		high = (UInt64)(product >> 64);
+		return (UInt64)product;
+#else
+		UInt64 aLow = (UInt32)a, aHigh = a >> 32;
+		UInt64 bLow = (UInt32)b, bHigh = b >> 32;
+		UInt64 lowLow = aLow * bLow;
+		UInt64 highLow = aHigh * bLow;
+		UInt64 lowHigh = aLow * bHigh;
+		UInt64 middle = (lowLow >> 32) + (UInt32)highLow + (UInt32)lowHigh;
+		high = aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+		return (middle << 32) | (UInt32)lowLow;
+#endif // INTX_64BIT_KERNELS
+	} // end function MulWide
+
+	/// <summary>
+	/// Montgomery multiplication: returns a * b / 2^64 modulo p.
+	/// </summary>
+	/// <param name="a">First value (any 64-bit one).</param>
+	/// <param name="b">Second value (less than p).</param>
+	/// <param name="prime">Prime to use.</param>
+	/// <returns>Product (less than p).</returns>
+	static UInt64 MulMod(const UInt64 a, const UInt64 b, const NttPrime &prime)
+	{
+		UInt64 high, reductionHigh;
+		UInt64 low = MulWide(a, b, high);
+		MulWide(low * prime.NegInverse, prime.Modulus, reductionHigh);
+
+		// Lower words sum is 0 modulo 2^64, so there is carry if only lower word is not 0
+		UInt64 result = high + reductionHigh + (low != 0 ? 1 : 0);
+		return result >= prime.Modulus ? result - prime.Modulus : result;
+	} // end function MulMod
+
+	/// <summary>
+	/// Converts value into Montgomery form.
+	/// </summary>
+	/// <param name="value">Value (any 64-bit one).</param>
+	/// <param name="prime">Prime to use.</param>
+	/// <returns>Value * 2^64 modulo p.</returns>
+	static UInt64 ToMontgomery(const UInt64 value, const NttPrime &prime)
+	{
+		return MulMod(value, prime.R2, prime);
+	} // end function ToMontgomery
+
+	/// <summary>
+	/// Raises value in Montgomery form to given power.
+	/// </summary>
+	static UInt64 Pow(const UInt64 value, const UInt64 vpower, const NttPrime &prime)
+	{
+		UInt64 result = ToMontgomery(1, prime), base = value;
+		for (UInt64 power = vpower; power != 0; power >>= 1)
+		{
+			if ((power & 1) != 0)
+			{
+				result = MulMod(result, base, prime);
+			} // end if
+			base = MulMod(base, base, prime);
+		} // end for
+		return result;
+	} // end function Pow
+
+	static UInt64 AddMod(const UInt64 a, const UInt64 b, const UInt64 modulus)
+	{
+		UInt64 sum = a + b;
+		return sum >= modulus ? sum - modulus : sum;
+	} // end function AddMod
+
+	static UInt64 SubMod(const UInt64 a, const UInt64 b, const UInt64 modulus)
+	{
+		return a >= b ? a - b : a - b + modulus;
+	} // end function SubMod
+
+	// Reduces value less than 2 * modulus.
+	static UInt64 Reduce(const UInt64 value, const UInt64 modulus)
+	{
+		return value >= modulus ? value - modulus : value;
+	} // end function Reduce
+
+}; // end class NttHelper
+
+#endif // !NTTHELPER_H
@@ -11,6 +11,8 @@ typedef unsigned int UInt32;
 #include "../PcgRandom/PcgRandomMinimal.h"
 #include "../Multipliers/IMultiplier.h"
 #include "../Multipliers/MultiplyManager.h"
+#include "../Dividers/IDivider.h"
+#include "../Dividers/DivideManager.h"
 #include "DigitOpHelper.h"
 #include "DigitHelper.h"
 #include "../Utils/Constants.h"
@@ -34,17 +36,17 @@ public:
 	/// <param name="int2">Second big integer.</param>
 	/// <param name="smallerInt">Resulting smaller big integer (by length only).</param>
 	/// <param name="biggerInt">Resulting bigger big integer (by length only).</param>
-	static void GetMinMaxLengthObjects(const IntX &int1, const IntX &int2, IntX &smallerInt, IntX &biggerInt)
+	static void GetMinMaxLengthObjects(const IntX &int1, const IntX &int2, const IntX *&smallerInt, const IntX *&biggerInt)
 	{
 		if (int1.length < int2.length)
 		{
-			smallerInt = IntX(int1);
-			biggerInt = IntX(int2);
+			smallerInt = &int1;
+			biggerInt = &int2;
 		} // end if
 		else
 		{
-			smallerInt = IntX(int2);
-			biggerInt = IntX(int1);
+			smallerInt = &int2;
+			biggerInt = &int1;
 		} // end else
 	} // end function GetMinMaxLengthObjects
 
@@ -67,25 +69,24 @@ public:
 		} // end if
 
 		  // Determine big int with lower length
-		IntX smallerInt;
-		IntX biggerInt;
+		const IntX *smallerInt, *biggerInt;
 		GetMinMaxLengthObjects(int1, int2, smallerInt, biggerInt);
 
 		// Check for add operation possibility
-		if (biggerInt.length == Constants::MaxIntValue)
+		if (biggerInt->length == Constants::MaxIntValue)
 		{
 			throw ArgumentException(Strings::IntegerTooBig);
 		} // end if
 
 		  // Create new big int object of needed length
-		IntX newInt = IntX(biggerInt.length + 1, int1.negative);
+		IntX newInt = IntX(biggerInt->length + 1, int1.negative);
 
 		// Do actual addition
 		newInt.length = DigitOpHelper::Add(
-			&biggerInt.digits[0],
-			biggerInt.length,
-			&smallerInt.digits[0],
-			smallerInt.length,
+			&biggerInt->digits[0],
+			biggerInt->length,
+			&smallerInt->digits[0],
+			smallerInt->length,
 			&newInt.digits[0]);
 
 		// Normalization may be needed
@@ -103,34 +104,33 @@ public:
 	static IntX Sub(const IntX &int1, const IntX &int2)
 	{
 		// Process zero values in special way
-		if (int1.length == 0) return IntX(int2.digits, true, int2.length);
+		if (int1.length == 0) return IntX(int2.digits.data(), true, int2.length);
 		if (int2.length == 0) return IntX(int1);
 
 		// Determine lower big int (without sign)
-		IntX smallerInt;
-		IntX biggerInt;
+		const IntX *smallerInt, *biggerInt;
 		int compareResult = DigitOpHelper::Cmp(&int1.digits[0], int1.length, &int2.digits[0], int2.length);
 		if (compareResult == 0) return IntX(); // integers are equal
 		if (compareResult < 0)
 		{
-			smallerInt = IntX(int1);
-			biggerInt = IntX(int2);
+			smallerInt = &int1;
+			biggerInt = &int2;
 		} // end if
 		else
 		{
-			smallerInt = IntX(int2);
-			biggerInt = IntX(int1);
+			smallerInt = &int2;
+			biggerInt = &int1;
 		} // end else
 
 		  // Create new big int object
-		IntX newInt = IntX(biggerInt.length, IntX::ReferenceEquals(int1, smallerInt) ^ int1.negative);
+		IntX newInt = IntX(biggerInt->length, (compareResult < 0) ^ int1.negative);
 
 		// Do actual subtraction
 		newInt.length = DigitOpHelper::Sub(
-			&biggerInt.digits[0],
-			biggerInt.length,
-			&smallerInt.digits[0],
-			smallerInt.length,
+			&biggerInt->digits[0],
+			biggerInt->length,
+			&smallerInt->digits[0],
+			smallerInt->length,
 			&newInt.digits[0]);
 
 		// Normalization may be needed
@@ -154,6 +154,313 @@ public:
 		return ((subtract ^ int1.negative) == int2.negative) ? Add(int1, int2) : Sub(int1, int2);
 	} // end function AddSub
 
+	/// <summary>
+	/// Makes big integer at least <paramref name="length" /> digits long by adding leading zeroes.
+	/// </summary>
+	/// <param name="intX">Big integer.</param>
+	/// <param name="length">Needed length.</param>
+	static void PadDigits(IntX &intX, const UInt32 length)
+	{
+		if (intX.length >= length) return;
+
+		if (intX.digits.size() < length)
+		{
+			intX.digits.resize(length);
+		} // end if
+
+		// Buffer may contain some garbage after the last digit
+		DigitHelper::SetBlockDigits(intX.digits.data() + intX.length, length - intX.length, 0U);
+		intX.length = length;
+	} // end function PadDigits
+
+	/// <summary>
+	/// Adds one big integer to another storing result into the first one.
+	/// Digits buffer of <paramref name="int1" /> is reused if it's big enough.
+	/// </summary>
+	/// <param name="int1">First big integer (also receives the result).</param>
+	/// <param name="int2">Second big integer.</param>
+	/// <exception cref="ArgumentException"><paramref name="int1" /> or <paramref name="int2" /> is too big for add operation.</exception>
+	static void AddInPlace(IntX &int1, const IntX &int2)
+	{
+		// Process zero values in special way
+		if (int2.length == 0) return;
+		if (int1.length == 0)
+		{
+			// Sign of the first big integer is kept
+			int1.digits.assign(int2.digits.begin(), int2.digits.begin() + int2.length);
+			int1.length = int2.length;
+			return;
+		} // end if
+
+		UInt32 length1 = int1.length, length2 = int2.length;
+		UInt32 maxLength = length1 < length2 ? length2 : length1;
+
+		// Check for add operation possibility
+		if (maxLength == Constants::MaxIntValue)
+		{
+			throw ArgumentException(Strings::IntegerTooBig);
+		} // end if
+
+		// Make room for the possible carry
+		if (int1.digits.size() <= maxLength)
+		{
+			int1.digits.resize(maxLength + 1);
+		} // end if
+
+		// Do actual addition (digits are added in place, so int1 and int2 may be the same object)
+		int1.length = DigitOpHelper::Add(
+			&int1.digits[0],
+			length1,
+			&int2.digits[0],
+			length2,
+			&int1.digits[0]);
+
+		// Normalization may be needed
+		int1.TryNormalize();
+	} // end function AddInPlace
+
+	/// <summary>
+	/// Subtracts one big integer from another storing result into the first one.
+	/// Digits buffer of <paramref name="int1" /> is reused if it's big enough.
+	/// </summary>
+	/// <param name="int1">First big integer (also receives the result).</param>
+	/// <param name="int2">Second big integer.</param>
+	static void SubInPlace(IntX &int1, const IntX &int2)
+	{
+		// Process zero values in special way
+		if (int1.length == 0)
+		{
+			int1.digits.assign(int2.digits.begin(), int2.digits.begin() + int2.length);
+			int1.length = int2.length;
+			int1.negative = int2.length != 0;
+			return;
+		} // end if
+		if (int2.length == 0) return;
+
+		int compareResult = DigitOpHelper::Cmp(&int1.digits[0], int1.length, &int2.digits[0], int2.length);
+		if (compareResult == 0)
+		{
+			// integers are equal - buffer capacity is kept for later use
+			int1.digits.clear();
+			int1.length = 0;
+			int1.negative = false;
+			return;
+		} // end if
+
+		if (compareResult > 0)
+		{
+			int1.length = DigitOpHelper::Sub(
+				&int1.digits[0],
+				int1.length,
+				&int2.digits[0],
+				int2.length,
+				&int1.digits[0]);
+		} // end if
+		else
+		{
+			UInt32 length1 = int1.length;
+			if (int1.digits.size() < int2.length)
+			{
+				int1.digits.resize(int2.length);
+			} // end if
+
+			int1.length = DigitOpHelper::Sub(
+				&int2.digits[0],
+				int2.length,
+				&int1.digits[0],
+				length1,
+				&int1.digits[0]);
+			int1.negative = !int1.negative;
+		} // end else
+
+		// Normalization may be needed
+		int1.TryNormalize();
+	} // end function SubInPlace
+
+	/// <summary>
+	/// Adds/subtracts one <see cref="IntX" /> to/from another storing result into the first one.
+	/// Determines which operation to use basing on operands signs.
+	/// </summary>
+	/// <param name="int1">First big integer (also receives the result).</param>
+	/// <param name="int2">Second big integer.</param>
+	/// <param name="subtract">Was subtraction initially.</param>
+	static void AddSubInPlace(IntX &int1, const IntX &int2, const bool subtract)
+	{
+		// Determine real operation type and result sign
+		if ((subtract ^ int1.negative) == int2.negative)
+		{
+			AddInPlace(int1, int2);
+		} // end if
+		else
+		{
+			SubInPlace(int1, int2);
+		} // end else
+	} // end function AddSubInPlace
+
+	/// <summary>
+	/// Multiplies one big integer by another storing result into the first one.
+	/// Multiplication by a one digit integer is done in place, in other cases product is
+	/// calculated into per-thread scratch big integer which then swaps digits with <paramref name="int1" />
+	/// (so the old digits buffer is reused by the next multiplication).
+	/// </summary>
+	/// <param name="int1">First big integer (also receives the result).</param>
+	/// <param name="int2">Second big integer.</param>
+	/// <exception cref="ArgumentException"><paramref name="int1" /> or <paramref name="int2" /> is too big for multiply operation.</exception>
+	static void MultiplyInPlace(IntX &int1, const IntX &int2)
+	{
+		if (int1.length == 0 || int2.length != 1)
+		{
+			IntX local;
+			IntX &product = GetScratch(local);
+			MultiplyTo(product, int1, int2);
+			SwapWithScratch(int1, product);
+
+			// Normalization may be needed
+			int1.TryNormalize();
+			return;
+		} // end if
+
+		// int2 may be the same object as int1 so read it before anything is changed
+		UInt32 digit = int2.digits[0];
+		bool negative = int1.negative ^ int2.negative;
+
+		// Check for multiply operation possibility
+		if (int1.length == Constants::MaxIntValue)
+		{
+			throw ArgumentException(Strings::IntegerTooBig);
+		} // end if
+
+		// Make room for the possible carry
+		if (int1.digits.size() <= int1.length)
+		{
+			int1.digits.resize(int1.length + 1);
+		} // end if
+
+		int1.length = DigitOpHelper::Multiply(int1.digits.data(), int1.length, digit, int1.digits.data());
+		int1.negative = negative;
+
+		// Normalization may be needed
+		int1.TryNormalize();
+	} // end function MultiplyInPlace
+
+	/// <summary>
+	/// Calculates <paramref name="int1" /> * <paramref name="int2" /> + <paramref name="int3" /> (with optional signs
+	/// change) into <paramref name="result" /> without intermediate <see cref="IntX" /> objects.
+	/// Any of the operands may be the same object as <paramref name="result" />.
+	/// </summary>
+	/// <param name="result">Resulting big integer.</param>
+	/// <param name="int1">First multiplier.</param>
+	/// <param name="int2">Second multiplier.</param>
+	/// <param name="int3">Addend.</param>
+	/// <param name="negateProduct">If true product is subtracted instead of being added.</param>
+	/// <param name="subtract">If true <paramref name="int3" /> is subtracted instead of being added.</param>
+	/// <exception cref="ArgumentException">Operands are too big for multiply operation.</exception>
+	static void MultiplyAdd(IntX &result, const IntX &int1, const IntX &int2, const IntX &int3, const bool negateProduct, const bool subtract)
+	{
+		IntX local;
+		IntX &product = GetScratch(local);
+		MultiplyTo(product, int1, int2);
+		if (negateProduct && product.length != 0)
+		{
+			product.negative = !product.negative;
+		} // end if
+
+		AddSubInPlace(product, int3, subtract);
+		SwapWithScratch(result, product);
+
+		// Normalization may be needed
+		result.TryNormalize();
+	} // end function MultiplyAdd
+
+	/// <summary>
+	/// Calculates (<paramref name="int1" /> * <paramref name="int2" />) % <paramref name="modulus" /> into
+	/// <paramref name="result" />. Product is kept in per-thread scratch buffer and remainder is got right from it.
+	/// Any of the operands may be the same object as <paramref name="result" />.
+	/// </summary>
+	/// <param name="result">Resulting big integer.</param>
+	/// <param name="int1">First multiplier.</param>
+	/// <param name="int2">Second multiplier.</param>
+	/// <param name="modulus">Divider.</param>
+	/// <param name="preparedInt2"><paramref name="int2" /> prepared for repeated multiplication (optional).</param>
+	/// <exception cref="DivideByZeroException"><paramref name="modulus" /> equals zero.</exception>
+	static void MultiplyModulo(IntX &result, const IntX &int1, const IntX &int2, const IntX &modulus,
+		const PreparedOperand *preparedInt2 = nullptr)
+	{
+		// Check if modulus equals zero
+		if (modulus.length == 0)
+		{
+			throw DivideByZeroException(Strings::DivideByZero);
+		} // end if
+
+		IntX local;
+		IntX &product = GetScratch(local);
+		MultiplyTo(product, int1, int2, preparedInt2);
+
+		// Buffers for remainder and for shifted modulus (per-thread ones unless memory resource is set)
+		static thread_local DigitsVector threadRemainderDigits, threadModulusBuffer;
+		DigitsVector localRemainderDigits, localModulusBuffer;
+		bool useThreadBuffers = &product != &local;
+		DigitsVector &remainderDigits = useThreadBuffers ? threadRemainderDigits : localRemainderDigits;
+		DigitsVector &modulusBuffer = useThreadBuffers ? threadModulusBuffer : localModulusBuffer;
+		remainderDigits.clear();
+		remainderDigits.resize(product.length + 2U);
+		modulusBuffer.clear();
+		modulusBuffer.resize(modulus.length);
+
+		// Remainder is built right in remainderDigits (product digits are spoiled)
+		UInt32 remainderLength = product.length;
+		DivideManager::GetCurrentDivider()->DivMod(
+			product.digits.data(),
+			remainderDigits.data(),
+			remainderLength,
+			(UInt32 *)modulus.digits.data(),
+			modulusBuffer.data(),
+			modulus.length,
+			nullptr,
+			DivModResultFlags::dmrfMod,
+			-2);
+
+		result.digits.swap(remainderDigits);
+		ReleaseResourceDigits(remainderDigits);
+		result.length = remainderLength;
+		result.negative = remainderLength != 0 && product.negative;
+
+		// Normalization may be needed
+		result.TryNormalize();
+	} // end function MultiplyModulo
+
+	/// <summary>
+	/// Calculates (<paramref name="int1" /> &lt;&lt; <paramref name="shift" />) + <paramref name="int3" /> (with optional signs
+	/// change) into <paramref name="result" /> without intermediate <see cref="IntX" /> objects.
+	/// Any of the operands may be the same object as <paramref name="result" />.
+	/// </summary>
+	/// <param name="result">Resulting big integer.</param>
+	/// <param name="int1">Big integer to shift.</param>
+	/// <param name="shift">Bits count to shift to the left (negative value means right shift).</param>
+	/// <param name="int3">Addend.</param>
+	/// <param name="negateShifted">If true shifted value is subtracted instead of being added.</param>
+	/// <param name="subtract">If true <paramref name="int3" /> is subtracted instead of being added.</param>
+	static void ShiftAdd(IntX &result, const IntX &int1, const long long shift, const IntX &int3, const bool negateShifted, const bool subtract)
+	{
+		IntX local;
+		IntX &shifted = GetScratch(local);
+		shifted.digits.assign(int1.digits.begin(), int1.digits.begin() + int1.length);
+		shifted.length = int1.length;
+		shifted.negative = int1.negative;
+
+		ShInPlace(shifted, shift, true);
+		if (negateShifted && shifted.length != 0)
+		{
+			shifted.negative = !shifted.negative;
+		} // end if
+
+		AddSubInPlace(shifted, int3, subtract);
+		SwapWithScratch(result, shifted);
+
+		// Normalization may be needed
+		result.TryNormalize();
+	} // end function ShiftAdd
+
 	/// <summary>
 	/// Returns a specified big integer raised to the specified power.
 	/// </summary>
@@ -190,7 +497,7 @@ public:
 		for (UInt32 powerMask = 1U << (msb - 1); powerMask != 0; powerMask >>= 1)
 		{
 			// Always square
-			res = multiplier->Multiply(res, res);
+			res = multiplier->Sqr(res);
 
 			// Maybe mul
 			if ((power & powerMask) != 0)
@@ -244,7 +551,7 @@ public:
 		{
 			int n, mask;
 
-			_rgu = bn.digits;
+			_rgu.assign(bn.digits.begin(), bn.digits.end());
 
 			if (bn == 0) n = 0;
 			else if (bn.negative) n = -1;
@@ -348,7 +655,7 @@ public:
 	/// <returns>Squared number.</returns>
 	static IntX Square(const IntX &value)
 	{
-		return  IntX::Pow(value, 2);
+		return MultiplyManager::GetCurrentMultiplier()->Sqr(value);
 	} // end function Square
 
 	/// <summary>
@@ -372,7 +679,7 @@ public:
 		while (b.CompareTo(a) >= 0)
 		{
 			mid = (a + b) >> 1;
-			if ((mid * mid).CompareTo(value) > 0)
+			if (Square(mid).CompareTo(value) > 0)
 				b = (mid - 1);
 			else
 				a = (mid + 1);
@@ -402,7 +709,7 @@ public:
 		i = 1;
 		while (i <= value)
 		{
-			result = result * i;
+			result *= i;
 			++i;
 		} // end while
 
@@ -464,15 +771,10 @@ public:
 		IntX int1 = intX1, int2 = intX2;
 
 		int shift;
-		IntX temp;
-
-		// check if int1 is negative and returns the absolute value of it.
-		if (int1.negative)
-			int1 = AbsoluteValue(int1);
 
-		// check if int2 is negative and returns the absolute value of it.
-		if (int2.negative)
-			int2 = AbsoluteValue(int2);
+		// make both values non negative (sign is just dropped, digits stay as they are).
+		int1.negative = false;
+		int2.negative = false;
 
 		// simple cases (termination)
 
@@ -482,23 +784,21 @@ public:
 
 		if (int2 == 0) return int1;
 
-		shift = __builtin_ctz(UInt32(int1 | int2));
-		int1 = int1 >> __builtin_ctz(UInt32(int1));
+		shift = __builtin_ctz(int1.digits[0] | int2.digits[0]);
+		int1 = std::move(int1) >> __builtin_ctz(int1.digits[0]);
 
 		while (int2 != 0)
 		{
-			int2 = int2 >> __builtin_ctz(UInt32(int2));
+			int2 = std::move(int2) >> __builtin_ctz(int2.digits[0]);
 			if (int1 > int2)
 			{
-				temp = int2;
-				int2 = int1;
-				int1 = temp;
+				std::swap(int1, int2);
 			} // end if
 
-			int2 = int2 - int1;
+			int2 = std::move(int2) - int1;
 		} // end while
 
-		return int1 << shift;
+		return std::move(int1) << shift;
 	} // end function GCD
 
 	/// <summary>
@@ -544,13 +844,13 @@ public:
 			/* Step X3. Divide and "Subtract" */
 			q = u3 / v3;
 			t3 = u3 % v3;
-			t1 = u1 + q * v1;
+			MultiplyAdd(t1, q, v1, u1, false, false);
 
 			/* Swap */
-			u1 = v1;
-			v1 = t1;
-			u3 = v3;
-			v3 = t3;
+			u1 = std::move(v1);
+			v1 = std::move(t1);
+			u3 = std::move(v3);
+			v3 = std::move(t3);
 			iter = -iter;
 		} // end while
 
@@ -577,15 +877,22 @@ public:
 	{
 		IntX result = 1;
 		IntX mValue = value % modulus;
-		IntX mExponent = exponent;
+		if (exponent.negative || exponent.length == 0) return result;
 
-		while (mExponent > 0)
-		{
-			if (mExponent.IsOdd()) result = (result * mValue) % modulus;
+		// Value is always the second multiplier, so it's prepared once (its FHT may be reused)
+		PreparedOperand preparedValue(mValue.digits.data(), mValue.length, modulus.length);
+		MultiplyManager::GetCurrentMultiplier()->Prepare(preparedValue);
 
-			mExponent = mExponent >> 1;
-			mValue = (mValue * mValue) % modulus;
-		} // end while
+		// Exponent bits are walked from the highest one
+		for (UInt32 i = exponent.length; i-- > 0;)
+		{
+			UInt32 digit = exponent.digits[i];
+			for (int bit = i + 1 == exponent.length ? Bits::Msb(digit) : 31; bit >= 0; --bit)
+			{
+				MultiplyModulo(result, result, result, modulus);
+				if ((digit >> bit & 1U) != 0) MultiplyModulo(result, result, mValue, modulus, &preparedValue);
+			} // end for
+		} // end for
 
 		return result;
 	} // end function ModPow
@@ -624,13 +931,13 @@ public:
 		{
 			quotient = old_r / r;
 			prov = r;
-			r = old_r - quotient * prov;
+			MultiplyAdd(r, quotient, prov, old_r, true, false);
 			old_r = prov;
 			prov = s;
-			s = old_s - quotient * prov;
+			MultiplyAdd(s, quotient, prov, old_s, true, false);
 			old_s = prov;
 			prov = t;
-			t = old_t - quotient * prov;
+			MultiplyAdd(t, quotient, prov, old_t, true, false);
 			old_t = prov;
 		} // end while
 
@@ -772,7 +1079,7 @@ public:
 
 		if (base == ZeroPointZero && !(value == 1)) return DoubleNaN;
 		
-		if (value.digits.empty()) return DoubleNegativeInfinity;
+		if (value.length == 0) return DoubleNegativeInfinity;
 		
 		if (value <= Constants::MaxUInt64Value)
 		{
@@ -780,22 +1087,22 @@ public:
 			return logN(base, tempDouble);
 		} // end if
 		
-		h = value.digits[value.digits.size() - 1];
+		h = value.digits[value.length - 1];
 
-		if (value.digits.size() > 1)
-			m = value.digits[value.digits.size() - 2];
+		if (value.length > 1)
+			m = value.digits[value.length - 2];
 		else
 			m = 0;
 
-		if (value.digits.size() > 2)
-			l = value.digits[value.digits.size() - 3];
+		if (value.length > 2)
+			l = value.digits[value.length - 3];
 		else
 			l = 0;
 
 		// measure the exact bit count
 		c = CbitHighZero(UInt32(h));
 
-		b = ((long long)value.digits.size() * 32) - c;
+		b = ((long long)value.length * 32) - c;
 
 		// extract most significant bits
 		x = (h << (32 + c)) | (m << c) | (l >> (32 - c));
@@ -1011,7 +1318,7 @@ public:
 	/// <remarks>
 	/// Source : Microsoft .NET Reference on GitHub
 	/// </remarks>
-	static void SetDigitsFromDouble(const double value, vector<UInt32> &digits, IntX &newInt)
+	static void SetDigitsFromDouble(const double value, DigitsVector &digits, IntX &newInt)
 	{
 		int sign, exp, kcbitUlong, kcbitUint, cu, cbit;
 		UInt64 man;
@@ -1063,7 +1370,7 @@ public:
 			if (sign < 0) tempSign = true;
 			else tempSign = false;
 
-			newInt = IntX(digits, tempSign);
+			newInt = IntX(digits.data(), tempSign, digits.size());
 			newInt.negative = tempSign;
 		} // end else
 	} // end function SetDigitsFromDouble
@@ -1232,6 +1539,111 @@ public:
 
 		return newInt;
 	} // end function Sh
+
+	/// <summary>
+	/// Shifts big integer in place.
+	/// Digits buffer of <paramref name="intX" /> is reused if it's big enough.
+	/// </summary>
+	/// <param name="intX">Big integer (also receives the result).</param>
+	/// <param name="shift">Bits count to shift.</param>
+	/// <param name="toLeft">If true the shifting to the left.</param>
+	/// <exception cref="ArgumentException">Result is too big.</exception>
+	static void ShInPlace(IntX &intX, const long long shift, bool toLeft)
+	{
+		// Zero can't be shifted, neither can we shift on zero value
+		if (intX.length == 0 || shift == 0) return;
+
+		// Determine real bits count and direction
+		UInt64 bitCount;
+		bool negativeShift;
+		DigitHelper::ToUInt64WithSign(shift, bitCount, negativeShift);
+		toLeft ^= negativeShift;
+
+		// Get position of the most significant bit in intX and amount of bits in intX
+		int msb = Bits::Msb(intX.digits[intX.length - 1]);
+		UInt64 intXBitCount = (UInt64)(intX.length - 1) * Constants::DigitBitCount + (UInt64)msb + 1UL;
+
+		// If shifting to the right and shift is too big then result is zero
+		if (!toLeft && bitCount >= intXBitCount)
+		{
+			intX.digits.clear();
+			intX.length = 0;
+			intX.negative = false;
+			return;
+		} // end if
+
+		// Calculate new bit count
+		UInt64 newBitCount = toLeft ? intXBitCount + bitCount : intXBitCount - bitCount;
+
+		// If shifting to the left and shift is too big to fit in big integer, throw an exception
+		if (toLeft && newBitCount > Constants::MaxBitCount)
+		{
+			throw ArgumentException(Strings::IntegerTooBig);
+		} // end if
+
+		// Get exact length of new big integer (no normalize is ever needed here)
+		UInt32 newLength = (UInt32)(newBitCount / Constants::DigitBitCount + (newBitCount % Constants::DigitBitCount == 0 ? 0UL : 1UL));
+
+		// Get full and small shift values
+		UInt32 fullDigits = (UInt32)(bitCount / Constants::DigitBitCount);
+		int smallShift = (int)(bitCount % Constants::DigitBitCount);
+
+		if (toLeft)
+		{
+			if (intX.digits.size() < newLength)
+			{
+				intX.digits.resize(newLength);
+			} // end if
+
+			UInt32 *digitsPtr = &intX.digits[0];
+			if (smallShift == 0)
+			{
+				memmove(digitsPtr + fullDigits, digitsPtr, intX.length * sizeof(UInt32));
+			} // end if
+			else
+			{
+				// Go from the most significant digit so source digits are read before they are overwritten
+				int smallShiftRev = Constants::DigitBitCount - smallShift;
+				UInt32 index = intX.length - 1;
+
+				if (newLength > intX.length + fullDigits)
+				{
+					digitsPtr[newLength - 1] = digitsPtr[index] >> smallShiftRev;
+				} // end if
+
+				for (; index > 0; --index)
+				{
+					digitsPtr[index + fullDigits] = (digitsPtr[index] << smallShift) | (digitsPtr[index - 1] >> smallShiftRev);
+				} // end for
+
+				digitsPtr[fullDigits] = digitsPtr[0] << smallShift;
+			} // end else
+
+			DigitHelper::SetBlockDigits(digitsPtr, fullDigits, 0U);
+		} // end if
+		else
+		{
+			UInt32 *digitsPtr = &intX.digits[0];
+			if (smallShift == 0)
+			{
+				memmove(digitsPtr, digitsPtr + fullDigits, newLength * sizeof(UInt32));
+			} // end if
+			else
+			{
+				// Source digits are always ahead of resulting ones so shifting forward is safe.
+				// If new result length is smaller then original length we shouldn't lose any digits
+				UInt32 shrLength = newLength;
+				if (shrLength < (intX.length - fullDigits))
+				{
+					shrLength++;
+				} // end if
+
+				DigitOpHelper::Shr(digitsPtr + fullDigits, shrLength, digitsPtr, smallShift, false);
+			} // end else
+		} // end else
+
+		intX.length = newLength;
+	} // end function ShInPlace
   
 	/// <summary>
 	/// Performs bitwise OR for two big integers.
@@ -1252,19 +1664,18 @@ public:
 		} // end if
 
 		// Determine big int with lower length
-		IntX smallerInt;
-		IntX biggerInt;
+		const IntX *smallerInt, *biggerInt;
 		GetMinMaxLengthObjects(int1, int2, smallerInt, biggerInt);
 
 		// Create new big int object of needed length
-		IntX newInt = IntX(biggerInt.length, int1.negative | int2.negative);
+		IntX newInt = IntX(biggerInt->length, int1.negative | int2.negative);
 
 		// Do actual operation
 		DigitOpHelper::BitwiseOr(
-			&biggerInt.digits[0],
-			biggerInt.length,
-			&smallerInt.digits[0],
-			smallerInt.length,
+			&biggerInt->digits[0],
+			biggerInt->length,
+			&smallerInt->digits[0],
+			smallerInt->length,
 			&newInt.digits[0]);
 
 		// Normalization may be needed
@@ -1288,18 +1699,17 @@ public:
 		} // end if
 
 		// Determine big int with lower length
-		IntX smallerInt;
-		IntX biggerInt;
+		const IntX *smallerInt, *biggerInt;
 		GetMinMaxLengthObjects(int1, int2, smallerInt, biggerInt);
 
 		// Create new big int object of needed length
-		IntX newInt = IntX(smallerInt.length, int1.negative & int2.negative);
+		IntX newInt = IntX(smallerInt->length, int1.negative & int2.negative);
 
 		// Do actual operation
 		newInt.length = DigitOpHelper::BitwiseAnd(
-			&biggerInt.digits[0],
-			&smallerInt.digits[0],
-			smallerInt.length,
+			&biggerInt->digits[0],
+			&smallerInt->digits[0],
+			smallerInt->length,
 			&newInt.digits[0]);
 
 		// Normalization may be needed
@@ -1327,19 +1737,18 @@ public:
 		} // end if
 
 		  // Determine big int with lower length
-		IntX smallerInt;
-		IntX biggerInt;
+		const IntX *smallerInt, *biggerInt;
 		GetMinMaxLengthObjects(int1, int2, smallerInt, biggerInt);
 
 		// Create new big int object of needed length
-		IntX newInt = IntX(biggerInt.length, int1.negative ^ int2.negative);
+		IntX newInt = IntX(biggerInt->length, int1.negative ^ int2.negative);
 
 		// Do actual operation
 		newInt.length = DigitOpHelper::ExclusiveOr(
-			&biggerInt.digits[0],
-			biggerInt.length,
-			&smallerInt.digits[0],
-			smallerInt.length,
+			&biggerInt->digits[0],
+			biggerInt->length,
+			&smallerInt->digits[0],
+			smallerInt->length,
 			&newInt.digits[0]);
 
 		// Normalization may be needed
@@ -1348,6 +1757,81 @@ public:
 		return newInt;
 	} // end function ExclusiveOr
 
+	/// <summary>
+	/// Performs bitwise OR for two big integers storing result into the first one.
+	/// Digits buffer of <paramref name="int1" /> is reused if it's big enough.
+	/// </summary>
+	/// <param name="int1">First big integer (also receives the result).</param>
+	/// <param name="int2">Second big integer.</param>
+	static void BitwiseOrInPlace(IntX &int1, const IntX &int2)
+	{
+		UInt32 length2 = int2.length;
+		PadDigits(int1, length2);
+
+		// Digits are processed one by one, so int1 and int2 may be the same object
+		DigitOpHelper::BitwiseOr(
+			int1.digits.data(),
+			int1.length,
+			int2.digits.data(),
+			length2,
+			int1.digits.data());
+		int1.negative = int1.negative | int2.negative;
+
+		// Normalization may be needed
+		int1.TryNormalize();
+	} // end function BitwiseOrInPlace
+
+	/// <summary>
+	/// Performs bitwise AND for two big integers storing result into the first one.
+	/// </summary>
+	/// <param name="int1">First big integer (also receives the result).</param>
+	/// <param name="int2">Second big integer.</param>
+	static void BitwiseAndInPlace(IntX &int1, const IntX &int2)
+	{
+		// Process zero values in special way
+		if (int1.length == 0 || int2.length == 0)
+		{
+			int1.digits.clear();
+			int1.length = 0;
+			int1.negative = false;
+			return;
+		} // end if
+
+		int1.length = DigitOpHelper::BitwiseAnd(
+			int1.digits.data(),
+			int2.digits.data(),
+			min(int1.length, int2.length),
+			int1.digits.data());
+		int1.negative = int1.length != 0 && (int1.negative & int2.negative);
+
+		// Normalization may be needed
+		int1.TryNormalize();
+	} // end function BitwiseAndInPlace
+
+	/// <summary>
+	/// Performs bitwise XOR for two big integers storing result into the first one.
+	/// Digits buffer of <paramref name="int1" /> is reused if it's big enough.
+	/// </summary>
+	/// <param name="int1">First big integer (also receives the result).</param>
+	/// <param name="int2">Second big integer.</param>
+	static void ExclusiveOrInPlace(IntX &int1, const IntX &int2)
+	{
+		UInt32 length2 = int2.length;
+		PadDigits(int1, length2);
+
+		// Digits are processed one by one, so int1 and int2 may be the same object
+		int1.length = DigitOpHelper::ExclusiveOr(
+			int1.digits.data(),
+			int1.length,
+			int2.digits.data(),
+			length2,
+			int1.digits.data());
+		int1.negative = int1.length != 0 && (int1.negative ^ int2.negative);
+
+		// Normalization may be needed
+		int1.TryNormalize();
+	} // end function ExclusiveOrInPlace
+
 	/// <summary>
 	/// Performs bitwise NOT for big integer.
 	/// </summary>
@@ -1376,6 +1860,118 @@ public:
 		return newInt;
 	} // end function OnesComplement
 
+private:
+
+	/// <summary>
+	/// Returns per-thread big integer used to hold intermediate results of in-place operations.
+	/// Its digits buffer is exchanged with results, so memory is reused from call to call.
+	/// While memory resource is set (see <see cref="IntXMemory" />) given local big integer is returned
+	/// instead, so that per-thread one never keeps memory of the resource.
+	/// </summary>
+	/// <param name="local">Big integer used while memory resource is set.</param>
+	static IntX &GetScratch(IntX &local)
+	{
+		static thread_local IntX scratch;
+		return IntXMemory::GetResource() == nullptr ? scratch : local;
+	} // end function GetScratch
+
+	/// <summary>
+	/// Exchanges values of result and scratch big integer (see <see cref="GetScratch" />).
+	/// Digits result had before are dropped if they come from memory resource.
+	/// </summary>
+	static void SwapWithScratch(IntX &result, IntX &scratch)
+	{
+		SwapValues(result, scratch);
+		ReleaseResourceDigits(scratch.digits);
+	} // end function SwapWithScratch
+
+	// Frees digits of per-thread buffer if they are allocated from memory resource (it may be gone by the next use).
+	static void ReleaseResourceDigits(DigitsVector &digits)
+	{
+		if (digits.GetResource() != nullptr)
+		{
+			digits = DigitsVector();
+		} // end if
+	} // end function ReleaseResourceDigits
+
+	/// <summary>
+	/// Exchanges values of two big integers.
+	/// </summary>
+	static void SwapValues(IntX &int1, IntX &int2)
+	{
+		int1.digits.swap(int2.digits);
+
+		// Length and sign are bit-fields, so std::swap can't be used
+		UInt32 length = int1.length;
+		bool negative = int1.negative;
+		int1.length = int2.length;
+		int1.negative = int2.negative;
+		int2.length = length;
+		int2.negative = negative;
+	} // end function SwapValues
+
+	/// <summary>
+	/// Multiplies two big integers storing result into the third one (its digits buffer is reused).
+	/// <paramref name="result" /> must not be the same object as <paramref name="int1" /> or <paramref name="int2" />.
+	/// </summary>
+	/// <param name="result">Resulting big integer.</param>
+	/// <param name="int1">First big integer.</param>
+	/// <param name="int2">Second big integer.</param>
+	/// <param name="preparedInt2"><paramref name="int2" /> prepared for repeated multiplication (optional).</param>
+	/// <exception cref="ArgumentException"><paramref name="int1" /> or <paramref name="int2" /> is too big for multiply operation.</exception>
+	static void MultiplyTo(IntX &result, const IntX &int1, const IntX &int2, const PreparedOperand *preparedInt2 = nullptr)
+	{
+		// Special behavior for zero cases
+		if (int1.length == 0 || int2.length == 0)
+		{
+			result.digits.clear();
+			result.length = 0;
+			result.negative = false;
+			return;
+		} // end if
+
+		// Get new big integer length and check it
+		UInt64 newLength = (UInt64)int1.length + (UInt64)int2.length;
+		if (newLength > Constants::MaxIntValue)
+		{
+			throw ArgumentException(Strings::IntegerTooBig);
+		} // end if
+
+		// Multipliers expect zeroed result digits
+		result.digits.clear();
+		result.digits.resize((UInt32)newLength);
+
+		// The same digits (or the same object) are squared; copies sharing digits may differ in sign
+		if (int1.digits.data() == int2.digits.data() && int1.length == int2.length && int1.negative == int2.negative)
+		{
+			result.length = MultiplyManager::GetCurrentMultiplier()->Sqr(
+				int1.digits.data(),
+				int1.length,
+				result.digits.data());
+			result.negative = false;
+			return;
+		} // end if
+
+		if (preparedInt2 != nullptr)
+		{
+			result.length = MultiplyManager::GetCurrentMultiplier()->Multiply(
+				*preparedInt2,
+				int1.digits.data(),
+				int1.length,
+				result.digits.data());
+		} // end if
+		else
+		{
+			result.length = MultiplyManager::GetCurrentMultiplier()->Multiply(
+				int1.digits.data(),
+				int1.length,
+				int2.digits.data(),
+				int2.length,
+				result.digits.data());
+		} // end else
+		result.negative = int1.negative ^ int2.negative;
+	} // end function MultiplyTo
+
 }; // end class OpHelper
 
 #endif // !OPHELPER_H
\ No newline at end of file
@@ -36,7 +36,7 @@ public:
 	/// <param name="charToDigits">Char->digit dictionary.</param>
 	/// <param name="digitsRes">Resulting digits.</param>
 	/// <returns>Parsed integer length.</returns>
-	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, std::vector<UInt32> &digitsRes)
+	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, DigitsVector &digitsRes)
 	{
 		UInt32 newLength = ParserBase::Parse(value, startIndex, endIndex, numberBase, charToDigits, digitsRes);
 
@@ -11,6 +11,7 @@ typedef unsigned int UInt32;
 #include "ParserBase.h"
 #include "../Utils/Dictionary.h"
 #include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
 #include "Bits.h"
 #include "../OpHelpers/StrRepHelper.h"
 #include "../OpHelpers/DigitHelper.h"
@@ -46,7 +47,7 @@ public:
 	/// <param name="charToDigits">Char->digit dictionary.</param>
 	/// <param name="digitsRes">Resulting digits.</param>
 	/// <returns>Parsed integer length.</returns>
-	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, std::vector<UInt32> &digitsRes)
+	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, DigitsVector &digitsRes)
 	{
 		UInt32 newLength = ParserBase::Parse(value, startIndex, endIndex, numberBase, charToDigits, digitsRes);
 
@@ -64,13 +65,13 @@ public:
 		UInt32 digitsLength = 1U << Bits::CeilLog2(valueLength);
 
 		// Prepare array for digits in other base
-		vector<UInt32> valueDigits(digitsLength);
+		PooledArray<UInt32> valueDigits(digitsLength, false);
 
 		// This second array will store integer lengths initially
-		vector<UInt32> valueDigits2(digitsLength);
+		PooledArray<UInt32> valueDigits2(digitsLength, false);
 
-		UInt32 * const valueDigitsStartPtr = &valueDigits[0];
-		UInt32 * const valueDigitsStartPtr2 = &valueDigits2[0];
+		UInt32 * const valueDigitsStartPtr = valueDigits.data();
+		UInt32 * const valueDigitsStartPtr2 = valueDigits2.data();
 
 		// In the string first digit means last in digits array
 		UInt32* valueDigitsPtr = valueDigitsStartPtr + valueLength - 1;
@@ -91,7 +92,8 @@ public:
 		} // end for
 		
 
-		// We have retrieved lengths array from pool - it needs to be cleared before using
+		// We have retrieved arrays from pool - they need to be cleared before using
+		DigitHelper::SetBlockDigits(valueDigitsStartPtr + valueLength, digitsLength - valueLength, 0);
 		DigitHelper::SetBlockDigits(valueDigitsStartPtr2 + valueLength, digitsLength - valueLength, 0);
 
 		// Now start from the digit arrays beginning
@@ -116,6 +118,10 @@ public:
 			else
 				baseInt = baseInt * baseInt;
 
+			// baseInt is multiplied by all higher parts on this level (they are less than it), so it's prepared once
+			PreparedOperand preparedBaseInt(baseInt.digits.data(), baseInt.length, baseInt.length);
+			multiplier->Prepare(preparedBaseInt);
+
 			// Start from arrays beginning
 			ptr1 = valueDigitsPtr;
 			ptr2 = valueDigitsPtr2;
@@ -137,8 +143,7 @@ public:
 
 					// Multiply per baseInt
 					hiLength = multiplier->Multiply(
-						&baseInt.digits[0], 
-						baseInt.length,
+						preparedBaseInt,
 						ptr1 + innerStep,
 						hiLength,
 						ptr2);
@@ -162,20 +167,18 @@ public:
 
 			// After inner cycle valueDigits will contain lengths and valueDigits2 will contain actual values
 			// so we need to swap them here
-			vector<UInt32> tempDigits = valueDigits;
-			valueDigits = valueDigits2;
-			valueDigits2 = tempDigits;
+			valueDigits.swap(valueDigits2);
 
-			//UInt32 *tempPtr = valueDigitsPtr;
-			//valueDigitsPtr = valueDigitsPtr2;
-			//valueDigitsPtr2 = tempPtr;
+			UInt32 *tempPtr = valueDigitsPtr;
+			valueDigitsPtr = valueDigitsPtr2;
+			valueDigitsPtr2 = tempPtr;
 		} // end for	
 
 		// Determine real length of converted number
 		UInt32 realLength = valueDigits2[0];
 
 		// Copy to result
-		memcpy((UInt32 *)(&digitsRes[0]), (UInt32 *)(&valueDigits[0]), realLength * sizeof(UInt32));
+		memcpy(digitsRes.data(), valueDigits.data(), realLength * sizeof(UInt32));
 
 		return realLength;
 	} // end func Parse
@@ -21,7 +21,7 @@ public:
 	
 	virtual IntX Parse(const string &value, const UInt32 numberBase, const Dictionary &charToDigits, bool checkFormat) = 0;
 
-	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, std::vector<UInt32> &digitsRes) = 0;
+	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, DigitsVector &digitsRes) = 0;
 
 }; // end class IParser
 
@@ -167,7 +167,7 @@ public:
 	/// <param name="charToDigits">Char->digit dictionary.</param>
 	/// <param name="digitsRes">Resulting digits.</param>
 	/// <returns>Parsed integer length.</returns>
-	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, std::vector<UInt32> &digitsRes)
+	virtual UInt32 Parse(const string &value, int startIndex, int endIndex, const UInt32 numberBase, const Dictionary &charToDigits, DigitsVector &digitsRes)
 	{
 		// Default implementation - always call pow2 parser if numberBase is pow of 2
 		return numberBase == 1U << Bits::Msb(numberBase)
@@ -3,6 +3,9 @@
 #ifndef INTXGLOBALSETTINGS_H
 #define INTXGLOBALSETTINGS_H
 
+// data types
+typedef unsigned int UInt32;
+
 #include "../Utils/Enums.h"
 
 class IntXGlobalSettings
@@ -70,6 +73,18 @@ public:
 		applyFhtValidityCheck = value;
 	} // end function setApplyFhtValidityCheck
 
+	// Maximal count of threads used by FHT of big transforms (see <see cref="FhtHelper::ParallelFht" />).
+	UInt32 getFhtThreadCount() const
+	{
+		return fhtThreadCount;
+	} // end function getFhtThreadCount
+
+	// 1 by default (FHT is done on calling thread only).
+	void setFhtThreadCount(UInt32 value)
+	{
+		fhtThreadCount = value;
+	} // end function setFhtThreadCount
+
 private:
 	MultiplyMode multiplyMode = MultiplyMode::mmAutoFht;
 	DivideMode divideMode = DivideMode::dmAutoNewton;
@@ -77,6 +92,7 @@ private:
 	ToStringMode toStringMode = ToStringMode::tsmFast;
 	bool autoNormalize = false;
 	bool applyFhtValidityCheck = true;
+	UInt32 fhtThreadCount = 1;
 
 }; // end class
 
@@ -7,48 +7,62 @@
 #include "IntXGlobalSettings.h"
 
 
+// <see cref="IntX" /> settings which are not stored in each instance: they are kept in one context
+// per thread (see <see cref="IntX::getSettings" />). Each value is taken from global settings until
+// it is set explicitly.
 class IntXSettings
 {
 public:
 	// Creates new <see cref="IntXSettings" /> instance.
-	// <param name="globalSettings">IntX global settings to copy.</param>
-	IntXSettings(IntXGlobalSettings &globalSettings)
+	// <param name="globalSettings">IntX global settings used for values which are not set.</param>
+	constexpr IntXSettings(IntXGlobalSettings &globalSettings)
+		: globalSettings(&globalSettings), toStringMode(ToStringMode::tsmFast), autoNormalize(false),
+		toStringModeSet(false), autoNormalizeSet(false)
 	{
-		// Copy local settings from global ones
-		autoNormalize = globalSettings.getAutoNormalize();
-		toStringMode = globalSettings.getToStringMode();
+		// Empty
 	} // end Constructor
 
-	// To string conversion mode used in this <see cref="IntX" /> instance.
+	// To string conversion mode used by <see cref="IntX" /> instances on this thread.
 	ToStringMode getToStringMode() const
 	{
-		return toStringMode;
+		return toStringModeSet ? toStringMode : globalSettings->getToStringMode();
 	} // end function getToStringMode
 
 	// Set to value from <see cref="IntX.GlobalSettings" /> by default.
 	void setToStringMode(ToStringMode value)
 	{
 		toStringMode = value;
+		toStringModeSet = true;
 	} // end function setToStringMode
 
 	// If true then each operation is ended with big integer normalization.
 	bool getAutoNormalize() const
 	{
-		return autoNormalize;
+		return autoNormalizeSet ? autoNormalize : globalSettings->getAutoNormalize();
 	} // end function getAutoNormalize
 
 	// Set to value from <see cref="IntX.GlobalSettings" /> by default.
 	void setAutoNormalize(bool value)
 	{
 		autoNormalize = value;
+		autoNormalizeSet = true;
 	} // end function setAutoNormalize
 
+	// Forgets explicitly set values, so that global ones are used again.
+	void Reset()
+	{
+		toStringModeSet = false;
+		autoNormalizeSet = false;
+	} // end function Reset
+
 private:
-	ToStringMode toStringMode = ToStringMode::tsmFast;
-	bool autoNormalize = false;
+	IntXGlobalSettings *globalSettings; // settings used for values which are not set
+	ToStringMode toStringMode;
+	bool autoNormalize;
+	bool toStringModeSet; // toStringMode was set explicitly
+	bool autoNormalizeSet; // autoNormalize was set explicitly
 
 }; // end class IntXSettings
 
 
 #endif // !INTXSETTINGS_H
-
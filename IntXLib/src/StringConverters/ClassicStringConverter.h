@@ -33,7 +33,7 @@ public:
 	/// <param name="numberBase">Base to use for output.</param>
 	/// <param name="outputLength">Calculated output length (will be corrected inside).</param>
 	/// <returns>Conversion result (later will be transformed to string).</returns>
-	virtual vector<UInt32> ToString(const vector<UInt32> &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
+	virtual vector<UInt32> ToString(const DigitsVector &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
 	{
 		vector<UInt32> outputArray = StringConverterBase::ToString(digits, length, numberBase, outputLength);
 
@@ -44,7 +44,7 @@ public:
 		outputArray = vector<UInt32>(outputLength + 1);
 
 		// Make a copy of initial data
-		vector<UInt32> digitsCopy(digits);
+		DigitsVector digitsCopy(digits);
 		//memcpy(&digitsCopy[0], &digits[0], length * sizeof(unsigned int));
 
 		// Calculate output numbers by dividing
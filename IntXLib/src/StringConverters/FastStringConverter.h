@@ -10,6 +10,7 @@ typedef unsigned int UInt32;
 #include "StringConverterBase.h"
 #include "IStringConverter.h"
 #include "../Utils/Constants.h"
+#include "../Utils/ArrayPool.h"
 #include "Bits.h"
 #include "../Dividers/IDivider.h"
 #include "../Multipliers/IMultiplier.h"
@@ -52,7 +53,7 @@ public:
 	/// <param name="numberBase">Base to use for output.</param>
 	/// <param name="outputLength">Calculated output length (will be corrected inside).</param>
 	/// <returns>Conversion result (later will be transformed to string).</returns>
-	virtual vector<UInt32> ToStringOLd(const vector<UInt32> &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
+	virtual vector<UInt32> ToStringOLd(const DigitsVector &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
 	{
 		vector<UInt32> outputArray = StringConverterBase::ToString(digits, length, numberBase, outputLength);
 
@@ -184,7 +185,7 @@ public:
 		return outputArray;
 	} // end function ToString
 
-	virtual vector<UInt32> ToString(const vector<UInt32> &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
+	virtual vector<UInt32> ToString(const DigitsVector &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
 	{
 		//UInt32 * const resultPtr1Const, * const resultPtr2Const, *tempBufferPtr;//
 		UInt32 *resultPtr1, *resultPtr2, *ptr1, *ptr2, *ptr1end, *baseIntPtr, *outputPtr;
@@ -195,7 +196,6 @@ public:
 		if (!outputArray.empty())
 			return outputArray;
 
-		vector<UInt32> *resultArray, *resultArray2, tempBuffer;
 		int resultLengthLog2, i;
 		UInt32 resultLength, loLength, innerStep, outerStep, j;
 		IMultiplier *multiplier;
@@ -212,14 +212,12 @@ public:
 		resultLength = UInt32(1) << resultLengthLog2;
 
 		// Create and initially fill array for transformed numbers storing
-		resultArray = new vector<UInt32>(resultLength);
-		//resultArray.resize(resultLength);
-		memmove(&(*resultArray)[0], &digits[0], length * sizeof(UInt32));
+		PooledArray<UInt32> resultArray(resultLength);
+		memmove(resultArray.data(), digits.data(), length * sizeof(UInt32));
 
 		// Create and initially fill array with lengths
-		resultArray2 = new vector<UInt32>(resultLength);
-		//resultArray2.resize(resultLength);
-		(*resultArray2)[0] = length;
+		PooledArray<UInt32> resultArray2(resultLength);
+		resultArray2[0] = length;
 
 		multiplier = MultiplyManager::GetCurrentMultiplier();
 		divider = DivideManager::GetCurrentDivider();
@@ -240,13 +238,13 @@ public:
 		} // end while
 
 		// Create temporary buffer for second digits when doing div operation
-		tempBuffer.resize(baseInt.length);
+		PooledArray<UInt32> tempBuffer(baseInt.length);
 
 		// We will use unsafe code here
 
-		UInt32 * const resultPtr1Const = &(*resultArray)[0];
-		UInt32 * const resultPtr2Const = &(*resultArray2)[0];
-		UInt32 * const tempBufferPtr = &tempBuffer[0];
+		UInt32 * const resultPtr1Const = resultArray.data();
+		UInt32 * const resultPtr2Const = resultArray2.data();
+		UInt32 * const tempBufferPtr = tempBuffer.data();
 
 		// Results pointers which will be modified (on swap)
 		resultPtr1 = resultPtr1Const;
@@ -290,10 +288,7 @@ public:
 
 			// After inner cycle resultArray will contain lengths and resultArray2 will contain actual values
 			// so we need to swap them here
-			::swap(resultArray, resultArray2);
-			//vector<UInt32> *tempArray = resultArray;
-			//*resultArray = *resultArray2;
-			//*resultArray2 = *tempArray;
+			resultArray.swap(resultArray2);
 
 			UInt32 *tempPtr = resultPtr1;
 			resultPtr1 = resultPtr2;
@@ -304,7 +299,7 @@ public:
 		} // end while
 
 		// Retrieve real output length
-		outputLength = DigitHelper::GetRealDigitsLength(&(*resultArray2)[0], outputLength);
+		outputLength = DigitHelper::GetRealDigitsLength(resultArray2.data(), outputLength);
 
 		// Create output array
 		outputArray.resize(outputLength);
@@ -319,9 +314,6 @@ public:
 				outputPtr[j] = resultPtr1[j];
 			++j;
 		} // end while
-		
-		delete resultArray;
-		delete resultArray2;
 
 		return outputArray;
 	} // end function 
@@ -34,7 +34,7 @@ public:
 	/// <param name="numberBase">Base to use for output.</param>
 	/// <param name="outputLength">Calculated output length (will be corrected inside).</param>
 	/// <returns>Conversion result (later will be transformed to string).</returns>
-	virtual vector<UInt32> ToString(const vector<UInt32> &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
+	virtual vector<UInt32> ToString(const DigitsVector &digits, const UInt32 length, const UInt32 numberBase, UInt32 &outputLength)
 	{
 		// Calculate real output length
 		int bitsInChar = Bits::Msb(numberBase);
@@ -0,0 +1,272 @@
+#pragma once
+
+#ifndef ARRAYPOOL_H
+#define ARRAYPOOL_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <cstring>
+#include "Constants.h"
+#include "MemoryResource.h"
+#include "../Bits.h"
+
+#ifdef INTX_USE_HUGE_PAGES
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/mman.h>
+#endif
+#endif // INTX_USE_HUGE_PAGES
+
+using namespace std;
+
+/// <summary>
+/// Pool of big arrays used as temporary buffers by fast algorithms (FHT, Newton division, fast parsing/converting).
+/// Arrays with length from 2^<see cref="Constants::MinPooledArraySizeLog2" /> up to
+/// 2^<see cref="Constants::MaxPooledArraySizeLog2" /> are rounded up to the nearest power of 2 and kept
+/// in one stack per size class, so the same (already mapped) memory is reused on the next call.
+/// Stacks are thread-local, so no locking is needed.
+/// </summary>
+/// <remarks>
+/// If INTX_USE_HUGE_PAGES is defined, arrays of <see cref="Constants::HugePageSize" /> bytes and bigger are
+/// allocated with huge pages (where OS allows it).
+/// </remarks>
+/// <typeparam name="T">Array item type (must be trivial).</typeparam>
+template <typename T>
+class ArrayPool
+{
+public:
+
+	/// <summary>
+	/// Either returns array of given size from pool or creates it.
+	/// </summary>
+	/// <param name="length">Array length (always pow of 2 for pooled arrays).</param>
+	/// <returns>Array (its content is undefined).</returns>
+	static T *GetArray(const UInt32 length)
+	{
+		int lengthLog2 = GetSizeClass(length);
+		if (lengthLog2 < 0) return AllocateArray(length);
+
+		vector<T *> &stack = GetStacks().items[lengthLog2 - Constants::MinPooledArraySizeLog2];
+		if (stack.empty()) return AllocateArray(1U << lengthLog2);
+
+		T *array = stack.back();
+		stack.pop_back();
+		return array;
+	} // end function GetArray
+
+	/// <summary>
+	/// Returns array back to the pool (or frees it if it can't be pooled).
+	/// </summary>
+	/// <param name="array">Array taken from <see cref="GetArray" />.</param>
+	/// <param name="length">Length which was passed to <see cref="GetArray" />.</param>
+	static void AddArray(T *array, const UInt32 length)
+	{
+		int lengthLog2 = GetSizeClass(length);
+		if (lengthLog2 < 0)
+		{
+			FreeArray(array, length);
+			return;
+		} // end if
+
+		vector<T *> &stack = GetStacks().items[lengthLog2 - Constants::MinPooledArraySizeLog2];
+		if (stack.size() >= Constants::MaxArrayPoolCount)
+		{
+			FreeArray(array, 1U << lengthLog2);
+			return;
+		} // end if
+
+		stack.push_back(array);
+	} // end function AddArray
+
+private:
+
+	static const UInt32 SizeClassCount = Constants::MaxPooledArraySizeLog2 - Constants::MinPooledArraySizeLog2 + 1;
+
+	// Per-thread stacks of free arrays (one for each size class).
+	struct Stacks
+	{
+		vector<T *> items[SizeClassCount];
+
+		~Stacks()
+		{
+			for (UInt32 i = 0; i < SizeClassCount; ++i)
+			{
+				for (T *array : items[i])
+				{
+					FreeArray(array, 1U << (i + Constants::MinPooledArraySizeLog2));
+				} // end for
+			} // end for
+		} // end destructor
+	}; // end struct Stacks
+
+	static Stacks &GetStacks()
+	{
+		static thread_local Stacks stacks;
+		return stacks;
+	} // end function GetStacks
+
+	/// <summary>
+	/// Returns Log2 of pooled array length or -1 if array of such length is not pooled.
+	/// </summary>
+	static int GetSizeClass(const UInt32 length)
+	{
+		if (length <= 1U << (Constants::MinPooledArraySizeLog2 - 1)) return -1;
+
+		int lengthLog2 = Bits::CeilLog2(length);
+		return (UInt32)lengthLog2 <= Constants::MaxPooledArraySizeLog2 ? lengthLog2 : -1;
+	} // end function GetSizeClass
+
+	static T *AllocateArray(const UInt32 length)
+	{
+#ifdef INTX_USE_HUGE_PAGES
+		UInt64 byteCount = (UInt64)length * sizeof(T);
+		if (byteCount >= Constants::HugePageSize)
+		{
+#if defined(_WIN32)
+			// Large pages need SeLockMemoryPrivilege - fall back to usual pages without it
+			SIZE_T largePageSize = GetLargePageMinimum();
+			void *array = nullptr;
+			if (largePageSize != 0)
+			{
+				SIZE_T size = (SIZE_T)((byteCount + largePageSize - 1) / largePageSize * largePageSize);
+				array = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+			} // end if
+			if (array == nullptr)
+			{
+				array = VirtualAlloc(nullptr, (SIZE_T)byteCount, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+			} // end if
+			if (array == nullptr) throw bad_alloc();
+			return (T *)array;
+#elif defined(__linux__)
+			void *array = mmap(nullptr, (size_t)byteCount, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (array == MAP_FAILED) throw bad_alloc();
+#ifdef MADV_HUGEPAGE
+			madvise(array, (size_t)byteCount, MADV_HUGEPAGE);
+#endif
+			return (T *)array;
+#endif
+		} // end if
+#endif // INTX_USE_HUGE_PAGES
+
+		return new T[length];
+	} // end function AllocateArray
+
+	static void FreeArray(T *array, const UInt32 length)
+	{
+#ifdef INTX_USE_HUGE_PAGES
+		UInt64 byteCount = (UInt64)length * sizeof(T);
+		if (byteCount >= Constants::HugePageSize)
+		{
+#if defined(_WIN32)
+			VirtualFree(array, 0, MEM_RELEASE);
+			return;
+#elif defined(__linux__)
+			munmap(array, (size_t)byteCount);
+			return;
+#endif
+		} // end if
+#else
+		// Length only tells huge pages from usual arrays
+		(void)length;
+#endif // INTX_USE_HUGE_PAGES
+
+		delete[] array;
+	} // end function FreeArray
+
+}; // end class ArrayPool
+
+/// <summary>
+/// Temporary array taken from <see cref="ArrayPool" /> and returned there on destruction.
+/// If memory resource is set for current thread (see <see cref="IntXMemory" />) array is allocated
+/// from it instead and pool is not used at all (resource may be gone before the next pool use).
+/// </summary>
+/// <typeparam name="T">Array item type (must be trivial).</typeparam>
+template <typename T>
+class PooledArray
+{
+public:
+
+	/// <summary>
+	/// Takes array from pool.
+	/// </summary>
+	/// <param name="length">Array length.</param>
+	/// <param name="clear">If true array is filled with zeroes (otherwise its content is undefined).</param>
+	explicit PooledArray(const UInt32 length, const bool clear = true) : _length(length), _resource(IntXMemory::GetResource())
+	{
+		_array = _resource != nullptr
+			? static_cast<T *>(_resource->allocate((size_t)length * sizeof(T), alignof(T)))
+			: ArrayPool<T>::GetArray(length);
+		if (clear && length != 0)
+		{
+			memset(_array, 0, length * sizeof(T));
+		} // end if
+	} // end constructor
+
+	PooledArray(PooledArray &&value) noexcept : _array(value._array), _length(value._length), _resource(value._resource)
+	{
+		value._array = nullptr;
+		value._length = 0;
+	} // end move constructor
+
+	~PooledArray()
+	{
+		if (_array == nullptr) return;
+
+		if (_resource != nullptr)
+		{
+			_resource->deallocate(_array, (size_t)_length * sizeof(T), alignof(T));
+		} // end if
+		else
+		{
+			ArrayPool<T>::AddArray(_array, _length);
+		} // end else
+	} // end destructor
+
+	PooledArray(const PooledArray &) = delete;
+	PooledArray &operator=(const PooledArray &) = delete;
+
+	T *data()
+	{
+		return _array;
+	} // end function data
+
+	const T *data() const
+	{
+		return _array;
+	} // end function data
+
+	UInt32 size() const
+	{
+		return _length;
+	} // end function size
+
+	T &operator[](const UInt32 index)
+	{
+		return _array[index];
+	} // end function operator[]
+
+	// Swaps arrays without copying their content.
+	void swap(PooledArray &value)
+	{
+		std::swap(_array, value._array);
+		std::swap(_length, value._length);
+		std::swap(_resource, value._resource);
+	} // end function swap
+
+private:
+	T *_array; // array from pool
+	UInt32 _length; // requested array length
+	MemoryResource *_resource; // resource array was allocated from (nullptr if it's taken from pool)
+
+}; // end class PooledArray
+
+#endif // !ARRAYPOOL_H
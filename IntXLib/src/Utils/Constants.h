@@ -61,17 +61,83 @@ public:
 	// Maximal allowed array pool items count in each stack.
 	static const UInt32 MaxArrayPoolCount = 1024;
 
+	// Minimal array size in bytes which is allocated using huge pages (if INTX_USE_HUGE_PAGES is defined).
+	static const UInt32 HugePageSize = 2097152;
+
+
+	// <see cref="IntX" /> length from which Karatsuba algorithm is used (in Karatsuba and auto-FHT modes).
+	// Before this length classic multiply algorithm works faster. It's also the recursion threshold.
+	static const UInt32 KaratsubaLengthLowerBound = 48;
+
+	// <see cref="IntX" /> length from which Karatsuba algorithm is used for squaring.
+	// Classic squaring takes half of multiplications, so it stays faster for longer big integers.
+	static const UInt32 KaratsubaSqrLengthLowerBound = 96;
+
+	// <see cref="IntX" /> length from which Toom-3 algorithm is used (in Toom-3, Toom-4 and auto-FHT modes).
+	// Before this length Karatsuba algorithm works faster. It's also the recursion threshold.
+	static const UInt32 Toom3LengthLowerBound = 800;
+
+	// <see cref="IntX" /> length from which Toom-4 algorithm is used (in Toom-4 and auto-FHT modes).
+	// Before this length Toom-3 algorithm works faster. It's also the recursion threshold.
+	static const UInt32 Toom4LengthLowerBound = 2000;
 
 	// <see cref="IntX" /> length from which FHT is used (in auto-FHT mode).
-	// Before this length usual multiply algorithm works faster.
-	static const UInt32 AutoFhtLengthLowerBound = 512;
+	// Before this length Toom-Cook multiply algorithms work faster.
+	static const UInt32 AutoFhtLengthLowerBound = 8192;
 
 	// <see cref="IntX" /> length 'till which FHT is used (in auto-FHT mode).
-	// After this length using of FHT may be unsafe due to big precision errors.
-	static const UInt32 AutoFhtLengthUpperBound = 67108864;
+	// After this length FHT needs too many doubles to stay precise (see <see cref="FhtHelper::GetDoubleDataLength" />).
+	static const UInt32 AutoFhtLengthUpperBound = 33554432;
+
+	// <see cref="IntX" /> length from which NTT is used (in NTT mode).
+	// Before this length Toom-Cook multiply algorithms work faster.
+	static const UInt32 NttLengthLowerBound = 4096;
+
+	// <see cref="IntX" /> length from which Schonhage-Strassen algorithm is used (in Schonhage-Strassen mode).
+	// Before this length NTT is used - it's faster and its memory usage doesn't matter for such lengths.
+	static const UInt32 SchonhageStrassenLengthLowerBound = 65536;
+
+	// Ring length from which pointwise products are computed recursively in Schonhage-Strassen algorithm.
+	// Shorter ones are computed by lower multiplier.
+	static const UInt32 SchonhageStrassenRecursionBound = 8192;
+
+	// Shorter <see cref="IntX" /> length from which FHT is used for unbalanced multiplication (in auto-FHT mode).
+	// Longer one is multiplied by blocks then, so FHT of the shorter one is done only once.
+	static const UInt32 AutoFhtUnbalancedLengthLowerBound = 6144;
+
+	// Minimal ratio of <see cref="IntX" /> lengths from which <see cref="AutoFhtUnbalancedLengthLowerBound" /> is used.
+	static const UInt32 AutoFhtUnbalancedRatio = 4;
+
+	// FHT slice length from which "butterfly" operations are processed by SIMD kernels (if CPU supports them).
+	// Must be at least 64, so each vector kernel loop gets whole vectors.
+	static const UInt32 FhtSimdLengthLowerBound = 64;
+
+	// FHT length (in doubles) from which transform is split into parallel tasks (if more than one thread is set,
+	// see <see cref="IntXGlobalSettings::setFhtThreadCount" />).
+	static const UInt32 FhtParallelLengthLowerBound = 262144;
+
+	// FHT slice length (in doubles) from which two levels of "butterfly" operations are done in one pass
+	// over data (see <see cref="FhtHelper::BlockedFhtButterflies" />); slices shorter than it fit into cache.
+	static const UInt32 FhtBlockedLengthLowerBound = 262144;
+
+	// Count of "butterfly" operations done by one chunk of blocked pass over FHT data (so that values changed
+	// by them fit into cache).
+	static const UInt32 FhtBlockedChunkLength = 512;
+
+	// Log2 of the longest FHT slice part (half of slice) which has table of all its trigonometry values (tables of
+	// longer ones keep only fine angles, see <see cref="FhtHelper::GetTwiddle" />); all full tables take about 2^(log2 + 3) bytes.
+	static const int FhtTwiddleTableLengthLog2 = 16;
+
+	// Maximal FHT slice length (in doubles) which is transformed by codelet: straight-line code generated from template
+	// for each length (see <see cref="FhtHelper::FhtCodelet" />; codelets are instantiated up to 1024 doubles).
+	static const UInt32 FhtCodeletLengthMax = 1024;
+
+	// Length (in doubles) of FHT blocks whose values are multiplied by other FHT result as soon as they are transformed
+	// (see <see cref="FhtHelper::ConvertDigitsToFht" />); such blocks of both results fit into cache.
+	static const UInt32 FhtMultiplyBlockLength = 8192;
 
-	// Number of lower digits used to check FHT multiplication result validity.
-	static const UInt32 FhtValidityCheckDigitCount = 10;
+	// Prime modulo which FHT multiplication result is checked (along with 2^64 - 1).
+	static const UInt32 FhtCheckPrime = 4294967291U;
 
 
 	// <see cref="IntX" /> length from which Newton approach is used (in auto-Newton mode).
@@ -102,8 +168,8 @@ public:
 	// Count of bits in one <see cref="IntX" /> digit.
 	static const UInt32 DigitBitCount = 32;
 
-	// Maximum count of bits which can fit in <see cref="IntX" />.
-	static const UInt64 MaxBitCount = 137438953440L;
+	// Maximum count of bits which can fit in <see cref="IntX" /> (its length is 31-bit field).
+	static const UInt64 MaxBitCount = 68719476704L;
 
 	// 2^<see cref="DigitBitCount"/>.
 	static const UInt64 BitCountStepOf2 = 4294967296L;
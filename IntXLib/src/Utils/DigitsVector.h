@@ -0,0 +1,528 @@
+#pragma once
+
+#ifndef DIGITSVECTOR_H
+#define DIGITSVECTOR_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include <cstring>
+#include <cstdint>
+#include <utility>
+#include <atomic>
+#include <new>
+#include "MemoryResource.h"
+
+using namespace std;
+
+// Count of digits stored right inside <see cref="IntX" /> object.
+// Inline digits share memory with heap pointer, so it can't be less than pointer size.
+// Default of 2 digits keeps IntX in 16 bytes (see <see cref="IntX::digits" />); define it as 8 to keep values
+// of up to 8 digits off the heap at the cost of 40-byte objects. Define it before including library headers to change it.
+#ifndef INTX_INLINE_DIGITS_COUNT
+#define INTX_INLINE_DIGITS_COUNT 2
+#endif // !INTX_INLINE_DIGITS_COUNT
+
+// Heap digits are shared between copies (copy-on-write) unless INTX_NO_COPY_ON_WRITE is defined.
+#ifndef INTX_NO_COPY_ON_WRITE
+#define INTX_COPY_ON_WRITE
+#endif // !INTX_NO_COPY_ON_WRITE
+
+/// <summary>
+/// Storage for <see cref="IntX" /> digits.
+/// Up to <see cref="InlineCount" /> digits are kept inside the object itself, heap is used only
+/// when number grows bigger. Implements the part of std::vector interface used by the library,
+/// so digits are always accessible via raw pointer no matter where they live.
+/// </summary>
+/// <remarks>
+/// Layout is kept compact: inline digits and heap pointer occupy the same memory, heap buffer
+/// capacity is kept in the buffer header and heap flag is the highest bit of digits count.
+/// Heap buffers are reference-counted. With INTX_COPY_ON_WRITE copying storage only shares the
+/// buffer, and it is duplicated on the first mutation (any non-const digits access or resizing).
+/// Storage may also borrow external digits (see <see cref="Borrow" />) - they are never changed or freed.
+/// Heap buffers are allocated from memory resource set for current thread (see <see cref="IntXMemory" />)
+/// and remember it, so they are freed there. Buffer is shared only by copies made under the same resource.
+/// </remarks>
+class DigitsVector
+{
+public:
+	//==================================================================
+	//  Constants
+	//==================================================================
+
+	static const UInt32 InlineCount = INTX_INLINE_DIGITS_COUNT; // digits count which fits without heap allocation
+
+	static_assert(INTX_INLINE_DIGITS_COUNT * sizeof(UInt32) >= sizeof(UInt32 *), "INTX_INLINE_DIGITS_COUNT digits must fit a pointer");
+
+	//==================================================================
+	//  Constructors
+	//==================================================================
+
+	// Creates empty storage.
+	DigitsVector() : _storage(), _size(0)
+	{
+		// Empty
+	} // end default constructor
+
+	/// <summary>
+	/// Creates storage with given count of zero digits.
+	/// </summary>
+	/// <param name="count">Digits count.</param>
+	explicit DigitsVector(const UInt32 count) : _storage(), _size(0)
+	{
+		resize(count);
+	} // end constructor
+
+	/// <summary>
+	/// Creates storage from digits range.
+	/// </summary>
+	/// <param name="first">First digit.</param>
+	/// <param name="last">Digit after the last one.</param>
+	DigitsVector(const UInt32 *first, const UInt32 *last) : _storage(), _size(0)
+	{
+		assign(first, last);
+	} // end constructor
+
+	DigitsVector(const DigitsVector &value) : _storage(), _size(0)
+	{
+		CopyFrom(value);
+	} // end copy constructor
+
+	DigitsVector(DigitsVector &&value) noexcept : _storage(), _size(0)
+	{
+		TakeFrom(value);
+	} // end move constructor
+
+	~DigitsVector()
+	{
+		FreeHeap();
+	} // end destructor
+
+	//==================================================================
+	//  Assignment
+	//==================================================================
+
+	DigitsVector &operator=(const DigitsVector &value)
+	{
+		if (this != &value)
+		{
+			CopyFrom(value);
+		} // end if
+		return *this;
+	} // end function operator=
+
+	DigitsVector &operator=(DigitsVector &&value) noexcept
+	{
+		if (this != &value)
+		{
+			FreeHeap();
+			TakeFrom(value);
+		} // end if
+		return *this;
+	} // end function operator=
+
+	/// <summary>
+	/// Replaces content with digits range. Existing buffer is reused if it's big enough.
+	/// </summary>
+	/// <param name="first">First digit.</param>
+	/// <param name="last">Digit after the last one.</param>
+	void assign(const UInt32 *first, const UInt32 *last)
+	{
+		UInt32 count = (UInt32)(last - first);
+		if (count > capacity() || IsShared())
+		{
+			if (count > InlineCount)
+			{
+				UInt32 *newDigits = AllocateHeap(count);
+				memcpy(newDigits, first, count * sizeof(UInt32));
+				FreeHeap();
+				SetHeapDigits(newDigits);
+			} // end if
+			else
+			{
+				// Shared buffer stays alive while digits are copied from it
+				UInt32 *oldDigits = GetDigits();
+				bool ownsHeap = !IsInline() && !IsBorrowed();
+				_size = 0;
+				if (count != 0)
+				{
+					memmove(_storage, first, count * sizeof(UInt32));
+				} // end if
+				if (ownsHeap)
+				{
+					ReleaseHeap(oldDigits);
+				} // end if
+			} // end else
+		} // end if
+		else if (count != 0)
+		{
+			memmove(GetDigits(), first, count * sizeof(UInt32));
+		} // end else
+		SetSize(count);
+	} // end function assign
+
+	//==================================================================
+	//  Properties
+	//==================================================================
+
+	UInt32 size() const
+	{
+		return _size & ~HeapFlag;
+	} // end function size
+
+	UInt32 capacity() const
+	{
+		if (IsInline()) return InlineCount;
+		return IsBorrowed() ? size() : GetHeader(GetDigits())->capacity;
+	} // end function capacity
+
+	bool empty() const
+	{
+		return size() == 0;
+	} // end function empty
+
+	// Returns true if digits are stored inside the object (no heap is used).
+	bool IsInline() const
+	{
+		return (_size & HeapFlag) == 0;
+	} // end function IsInline
+
+	// Returns true if heap digits are shared with another storage (copy-on-write) or borrowed.
+	bool IsShared() const
+	{
+		return !IsInline() && (IsBorrowed() || GetHeader(GetDigits())->refCount.load(memory_order_acquire) != 1);
+	} // end function IsShared
+
+	// Returns memory resource of heap digits (nullptr for default heap, inline or borrowed digits).
+	MemoryResource *GetResource() const
+	{
+		return IsInline() || IsBorrowed() ? nullptr : GetHeader(GetDigits())->resource;
+	} // end function GetResource
+
+	// Returns true if storage refers to external digits (see <see cref="Borrow" />).
+	bool IsBorrowed() const
+	{
+		return !IsInline() && (GetHeapWord() & BorrowedTag) != 0;
+	} // end function IsBorrowed
+
+	/// <summary>
+	/// Makes storage refer to external digits without copying them.
+	/// Borrowed digits are never changed or freed by the storage: they are copied on the first
+	/// mutation, and copying the storage copies them as well. They must outlive the storage.
+	/// </summary>
+	/// <param name="digits">External digits (at least 4-byte aligned).</param>
+	/// <param name="count">Digits count.</param>
+	void Borrow(const UInt32 *digits, const UInt32 count)
+	{
+		FreeHeap();
+		uintptr_t word = reinterpret_cast<uintptr_t>(digits) | BorrowedTag;
+		memcpy(_storage, &word, sizeof(word));
+		_size = HeapFlag | count;
+	} // end function Borrow
+
+	//==================================================================
+	//  Digits access
+	//==================================================================
+
+	UInt32 *data()
+	{
+		MakeUnique();
+		return GetDigits();
+	} // end function data
+
+	const UInt32 *data() const
+	{
+		return GetDigits();
+	} // end function data
+
+	UInt32 *begin()
+	{
+		MakeUnique();
+		return GetDigits();
+	} // end function begin
+
+	const UInt32 *begin() const
+	{
+		return GetDigits();
+	} // end function begin
+
+	UInt32 *end()
+	{
+		MakeUnique();
+		return GetDigits() + size();
+	} // end function end
+
+	const UInt32 *end() const
+	{
+		return GetDigits() + size();
+	} // end function end
+
+	UInt32 &operator[](const UInt32 index)
+	{
+		MakeUnique();
+		return GetDigits()[index];
+	} // end function operator[]
+
+	const UInt32 &operator[](const UInt32 index) const
+	{
+		return GetDigits()[index];
+	} // end function operator[]
+
+	bool operator==(const DigitsVector &value) const
+	{
+		UInt32 count = size();
+		return count == value.size() && (count == 0 || memcmp(GetDigits(), value.GetDigits(), count * sizeof(UInt32)) == 0);
+	} // end function operator==
+
+	bool operator!=(const DigitsVector &value) const
+	{
+		return !(*this == value);
+	} // end function operator!=
+
+	//==================================================================
+	//  Size management
+	//==================================================================
+
+	/// <summary>
+	/// Changes digits count. New digits are set to zero.
+	/// </summary>
+	/// <param name="count">New digits count.</param>
+	void resize(const UInt32 count)
+	{
+		UInt32 oldCount = size();
+		UInt32 oldCapacity = capacity();
+		if (count > oldCapacity)
+		{
+			// Grow geometrically so that repeated growing stays cheap
+			reserve(count < oldCapacity * 2 ? oldCapacity * 2 : count);
+		} // end if
+		if (count > oldCount)
+		{
+			// Shrinking keeps shared buffer as is - digits are not changed
+			MakeUnique();
+			memset(GetDigits() + oldCount, 0, (count - oldCount) * sizeof(UInt32));
+		} // end if
+		SetSize(count);
+	} // end function resize
+
+	/// <summary>
+	/// Makes sure storage can hold given count of digits without reallocation.
+	/// </summary>
+	/// <param name="count">Digits count.</param>
+	void reserve(const UInt32 count)
+	{
+		if (count <= capacity()) return;
+
+		UInt32 oldCount = size();
+		UInt32 *newDigits = AllocateHeap(count);
+		if (oldCount != 0)
+		{
+			memcpy(newDigits, GetDigits(), oldCount * sizeof(UInt32));
+		} // end if
+		FreeHeap();
+		SetHeapDigits(newDigits);
+		SetSize(oldCount);
+	} // end function reserve
+
+	// Removes all digits but keeps the buffer for later use (shared buffer is released).
+	void clear()
+	{
+		if (IsShared())
+		{
+			FreeHeap();
+		} // end if
+		SetSize(0);
+	} // end function clear
+
+	// Exchanges content with another storage (heap buffers are swapped without copying).
+	void swap(DigitsVector &value)
+	{
+		DigitsVector temp(std::move(value));
+		value = std::move(*this);
+		*this = std::move(temp);
+	} // end function swap
+
+	// Frees unused heap memory (moves digits back inside the object if they fit).
+	// Shared buffer is left as is since it is still used by other copies.
+	void shrink_to_fit()
+	{
+		UInt32 count = size();
+		if (IsInline() || capacity() == count || IsShared()) return;
+
+		UInt32 *oldDigits = GetDigits();
+		if (count <= InlineCount)
+		{
+			_size = 0;
+			if (count != 0)
+			{
+				memcpy(_storage, oldDigits, count * sizeof(UInt32));
+			} // end if
+		} // end if
+		else
+		{
+			UInt32 *newDigits = AllocateHeap(count);
+			memcpy(newDigits, oldDigits, count * sizeof(UInt32));
+			SetHeapDigits(newDigits);
+		} // end else
+		SetSize(count);
+		ReleaseHeap(oldDigits);
+	} // end function shrink_to_fit
+
+private:
+	//==================================================================
+	//  Private constants
+	//==================================================================
+
+	static const UInt32 HeapFlag = 0x80000000; // set in _size if digits are stored on heap
+
+	static const uintptr_t BorrowedTag = 1; // set in heap pointer if digits are borrowed
+
+	//==================================================================
+	//  Private methods
+	//==================================================================
+
+	// Header placed right before heap digits (keeps them 8-byte aligned).
+	struct HeapHeader
+	{
+		atomic<UInt32> refCount; // count of storages using the buffer
+		UInt32 capacity; // digits count which fits into the buffer
+		MemoryResource *resource; // resource buffer was allocated from
+	}; // end struct HeapHeader
+
+	static HeapHeader *GetHeader(UInt32 *digits)
+	{
+		return reinterpret_cast<HeapHeader *>(digits) - 1;
+	} // end function GetHeader
+
+	// Allocates heap buffer for given digits count (with reference count of 1) from current memory resource.
+	static UInt32 *AllocateHeap(const UInt32 count)
+	{
+		MemoryResource *resource = IntXMemory::GetResource();
+		HeapHeader *header = static_cast<HeapHeader *>(IntXMemory::Allocate(resource, GetHeapSize(count), alignof(HeapHeader)));
+		new (&header->refCount) atomic<UInt32>(1);
+		header->capacity = count;
+		header->resource = resource;
+		return reinterpret_cast<UInt32 *>(header + 1);
+	} // end function AllocateHeap
+
+	// Drops one reference to heap buffer and frees it when it's not used anymore.
+	static void ReleaseHeap(UInt32 *digits)
+	{
+		HeapHeader *header = GetHeader(digits);
+		if (header->refCount.load(memory_order_acquire) == 1 || header->refCount.fetch_sub(1, memory_order_acq_rel) == 1)
+		{
+			MemoryResource *resource = header->resource;
+			size_t size = GetHeapSize(header->capacity);
+			header->refCount.~atomic<UInt32>();
+			IntXMemory::Deallocate(resource, header, size, alignof(HeapHeader));
+		} // end if
+	} // end function ReleaseHeap
+
+	// Returns size of heap buffer (with header) for given digits count.
+	static size_t GetHeapSize(const UInt32 count)
+	{
+		return sizeof(HeapHeader) + (size_t)count * sizeof(UInt32);
+	} // end function GetHeapSize
+
+	// Returns heap pointer as it is stored (with borrowed tag).
+	uintptr_t GetHeapWord() const
+	{
+		uintptr_t word;
+		memcpy(&word, _storage, sizeof(word));
+		return word;
+	} // end function GetHeapWord
+
+	// Returns pointer to digits (either inline or heap ones).
+	UInt32 *GetDigits() const
+	{
+		if (IsInline())
+		{
+			return const_cast<UInt32 *>(_storage);
+		} // end if
+
+		return reinterpret_cast<UInt32 *>(GetHeapWord() & ~BorrowedTag);
+	} // end function GetDigits
+
+	// Stores heap digits pointer (digits count is kept).
+	void SetHeapDigits(UInt32 *digits)
+	{
+		memcpy(_storage, &digits, sizeof(digits));
+		_size |= HeapFlag;
+	} // end function SetHeapDigits
+
+	// Sets digits count (heap flag is kept).
+	void SetSize(const UInt32 count)
+	{
+		_size = (_size & HeapFlag) | count;
+	} // end function SetSize
+
+	// Frees heap buffer (if any) and returns to inline one.
+	void FreeHeap()
+	{
+		if (!IsInline())
+		{
+			if (!IsBorrowed())
+			{
+				ReleaseHeap(GetDigits());
+			} // end if
+			_size = 0;
+		} // end if
+	} // end function FreeHeap
+
+	// Makes private copy of shared heap digits before they are changed.
+	void MakeUnique()
+	{
+		if (!IsShared()) return;
+
+		UInt32 *oldDigits = GetDigits();
+		UInt32 count = size();
+		bool borrowed = IsBorrowed();
+		UInt32 *newDigits = AllocateHeap(borrowed ? count : GetHeader(oldDigits)->capacity);
+		if (count != 0)
+		{
+			memcpy(newDigits, oldDigits, count * sizeof(UInt32));
+		} // end if
+		if (!borrowed)
+		{
+			ReleaseHeap(oldDigits);
+		} // end if
+		SetHeapDigits(newDigits);
+	} // end function MakeUnique
+
+	// Copies digits from another storage (heap digits are just shared if copy-on-write is on).
+	// Buffer from other memory resource is copied, so that the copy doesn't depend on that resource.
+	void CopyFrom(const DigitsVector &value)
+	{
+#ifdef INTX_COPY_ON_WRITE
+		if (!value.IsInline() && !value.IsBorrowed() && GetHeader(value.GetDigits())->resource == IntXMemory::GetResource())
+		{
+			GetHeader(value.GetDigits())->refCount.fetch_add(1, memory_order_relaxed);
+			FreeHeap();
+			memcpy(_storage, value._storage, sizeof(_storage));
+			_size = value._size;
+			return;
+		} // end if
+#endif // INTX_COPY_ON_WRITE
+
+		assign(value.begin(), value.end());
+	} // end function CopyFrom
+
+	// Takes digits over from another storage which is left empty.
+	void TakeFrom(DigitsVector &value)
+	{
+		memcpy(_storage, value._storage, sizeof(_storage));
+		_size = value._size;
+		value._size = 0;
+	} // end function TakeFrom
+
+	//==================================================================
+	//  Internal fields
+	//==================================================================
+
+	UInt32 _storage[INTX_INLINE_DIGITS_COUNT]; // inline digits or pointer to heap digits
+	UInt32 _size; // digits count (with HeapFlag set if digits are on heap)
+
+}; // end class DigitsVector
+
+#endif // !DIGITSVECTOR_H
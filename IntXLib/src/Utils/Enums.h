@@ -22,7 +22,29 @@ enum MultiplyMode
 
 	// Classic method is used.
 	// Time estimate is O(n ^ 2).
-	mmClassic = 2
+	mmClassic = 2,
+
+	// Karatsuba method is used for big integers longer than 48 digits.
+	// Time estimate is O(n ^ 1.585).
+	mmKaratsuba = 3,
+
+	// Toom-3 method is used for big integers longer than 800 digits (Karatsuba one for shorter).
+	// Time estimate is O(n ^ 1.465).
+	mmToom3 = 4,
+
+	// Toom-4 method is used for big integers longer than 2000 digits (Toom-3 and Karatsuba ones for shorter).
+	// Time estimate is O(n ^ 1.404).
+	mmToom4 = 5,
+
+	// Exact NTT (number-theoretic transform) is used for big integers longer than 4096 digits.
+	// Time estimate is O(n * log n). Result validity check is not needed.
+	// It's also used in auto-FHT mode for big integers too long for FHT.
+	mmNtt = 6,
+
+	// Schonhage-Strassen method is used for big integers longer than 65536 digits (NTT one for shorter).
+	// Time estimate is O(n * log n * log log n). It's slower than NTT and FHT, but needs much less
+	// temporary memory, so it's meant for giant big integers.
+	mmSchonhageStrassen = 7
 };  // end enum MultiplyMode
 
 // Big integers divide mode used in <see cref="IntX" />.
@@ -0,0 +1,164 @@
+#pragma once
+
+#ifndef MEMORYRESOURCE_H
+#define MEMORYRESOURCE_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include <cstddef>
+#include <new>
+
+// std::pmr::memory_resource is used when standard library has it (C++17), otherwise class with
+// the same interface is declared. Define INTX_NO_PMR to always use own declaration.
+#if !defined(INTX_NO_PMR) && (__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#if defined(__has_include)
+#if __has_include(<memory_resource>)
+#define INTX_PMR
+#endif
+#endif
+#endif
+
+#ifdef INTX_PMR
+#include <memory_resource>
+#endif // INTX_PMR
+
+using namespace std;
+
+#ifdef INTX_PMR
+
+typedef std::pmr::memory_resource MemoryResource;
+
+#else
+
+/// <summary>
+/// Source of memory for <see cref="IntX" /> digits and temporary buffers (same interface as std::pmr::memory_resource).
+/// </summary>
+class MemoryResource
+{
+public:
+	virtual ~MemoryResource() {}
+
+	void *allocate(const size_t bytes, const size_t alignment = alignof(max_align_t))
+	{
+		return do_allocate(bytes, alignment);
+	} // end function allocate
+
+	void deallocate(void *p, const size_t bytes, const size_t alignment = alignof(max_align_t))
+	{
+		do_deallocate(p, bytes, alignment);
+	} // end function deallocate
+
+	bool is_equal(const MemoryResource &other) const noexcept
+	{
+		return do_is_equal(other);
+	} // end function is_equal
+
+private:
+	virtual void *do_allocate(size_t bytes, size_t alignment) = 0;
+	virtual void do_deallocate(void *p, size_t bytes, size_t alignment) = 0;
+	virtual bool do_is_equal(const MemoryResource &other) const noexcept = 0;
+
+}; // end class MemoryResource
+
+#endif // INTX_PMR
+
+/// <summary>
+/// Memory resource used for <see cref="IntX" /> allocations on current thread.
+/// Null resource (the default one) means global operator new and operator delete.
+/// </summary>
+/// <remarks>
+/// Resource is used for every digits buffer and temporary buffer (multiplication, division, parsing,
+/// converting to string) allocated on the thread while it is set. Each digits buffer remembers its
+/// resource, so it is always freed there. Copying big integer while another resource is set copies
+/// digits instead of sharing them, so the copy doesn't depend on the original resource.
+/// </remarks>
+class IntXMemory
+{
+public:
+	// Returns memory resource set for current thread (or nullptr).
+	static MemoryResource *GetResource()
+	{
+		return Current();
+	} // end function GetResource
+
+	// Sets memory resource for current thread (nullptr means global operator new).
+	static void SetResource(MemoryResource *resource)
+	{
+		Current() = resource;
+	} // end function SetResource
+
+	/// <summary>
+	/// Allocates memory block from given resource.
+	/// </summary>
+	/// <param name="resource">Memory resource (nullptr means global operator new).</param>
+	/// <param name="bytes">Block size.</param>
+	/// <param name="alignment">Block alignment (not bigger than alignof(max_align_t)).</param>
+	/// <returns>Allocated block.</returns>
+	static void *Allocate(MemoryResource *resource, const size_t bytes, const size_t alignment)
+	{
+		return resource != nullptr ? resource->allocate(bytes, alignment) : ::operator new(bytes);
+	} // end function Allocate
+
+	/// <summary>
+	/// Frees memory block allocated by <see cref="Allocate" />.
+	/// </summary>
+	/// <param name="resource">Memory resource block was allocated from.</param>
+	/// <param name="p">Block.</param>
+	/// <param name="bytes">Block size.</param>
+	/// <param name="alignment">Block alignment.</param>
+	static void Deallocate(MemoryResource *resource, void *p, const size_t bytes, const size_t alignment)
+	{
+		if (resource != nullptr)
+		{
+			resource->deallocate(p, bytes, alignment);
+		} // end if
+		else
+		{
+			::operator delete(p);
+		} // end else
+	} // end function Deallocate
+
+private:
+	static MemoryResource *&Current()
+	{
+		static thread_local MemoryResource *resource = nullptr;
+		return resource;
+	} // end function Current
+
+}; // end class IntXMemory
+
+/// <summary>
+/// Sets memory resource for <see cref="IntX" /> allocations on current thread while the object exists.
+/// </summary>
+/// <example>
+///     std::pmr::monotonic_buffer_resource arena;
+///     {
+///         IntXMemoryScope scope(&arena);
+///         IntX value = IntX::Pow(3, 100000);   // all memory comes from arena
+///         text = value.ToString();
+///     } // values allocated in the scope must be destroyed before arena
+/// </example>
+class IntXMemoryScope
+{
+public:
+	explicit IntXMemoryScope(MemoryResource *resource) : previous(IntXMemory::GetResource())
+	{
+		IntXMemory::SetResource(resource);
+	} // end constructor
+
+	~IntXMemoryScope()
+	{
+		IntXMemory::SetResource(previous);
+	} // end destructor
+
+	IntXMemoryScope(const IntXMemoryScope &) = delete;
+	IntXMemoryScope &operator=(const IntXMemoryScope &) = delete;
+
+private:
+	MemoryResource *previous; // resource which was set before the scope
+
+}; // end class IntXMemoryScope
+
+#endif // !MEMORYRESOURCE_H
@@ -0,0 +1,155 @@
+#pragma once
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+// data types
+typedef unsigned long long UInt64;
+typedef unsigned int UInt32;
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+using namespace std;
+
+/// <summary>
+/// Pool of worker threads used to split big transforms (see <see cref="FhtHelper" />) into parallel tasks.
+/// Workers are created on first use and live until program exit.
+/// Only one thread can use pool at once: if it's busy (or tasks run other tasks themselves),
+/// tasks are just run on calling thread one by one.
+/// </summary>
+class ThreadPool
+{
+public:
+
+	/// <summary>
+	/// Runs tasks with numbers 0..<paramref name="taskCount" />-1 on calling thread and pool workers;
+	/// returns when all of them are done.
+	/// </summary>
+	/// <param name="threadCount">Maximal count of threads (including calling one) running tasks.</param>
+	/// <param name="taskCount">Count of tasks.</param>
+	/// <param name="task">Task function (takes task number, must not throw).</param>
+	static void Run(const UInt32 threadCount, const UInt32 taskCount, const function<void(UInt32)> &task)
+	{
+		ThreadPool &pool = GetInstance();
+
+		unique_lock<mutex> runLock(pool.runMutex, try_to_lock);
+		if (threadCount <= 1 || taskCount <= 1 || !runLock.owns_lock())
+		{
+			for (UInt32 i = 0; i < taskCount; ++i)
+			{
+				task(i);
+			} // end for
+			return;
+		} // end if
+
+		UInt32 workerCount = (threadCount < taskCount ? threadCount : taskCount) - 1;
+		while (pool.workers.size() < workerCount)
+		{
+			pool.workers.push_back(thread(&ThreadPool::WorkerLoop, &pool));
+		} // end while
+
+		unique_lock<mutex> lock(pool.jobMutex);
+		pool.job = &task;
+		++pool.jobId;
+		pool.nextTask = 0;
+		pool.taskCount = taskCount;
+		pool.pendingTaskCount = taskCount;
+		pool.freeWorkerCount = workerCount;
+		pool.jobReady.notify_all();
+
+		// Calling thread takes tasks too and then waits for the ones taken by workers
+		pool.RunTasks(lock);
+		pool.jobDone.wait(lock, [&pool] { return pool.pendingTaskCount == 0; });
+		pool.job = nullptr;
+	} // end function Run
+
+	~ThreadPool()
+	{
+		{
+			lock_guard<mutex> lock(jobMutex);
+			isStopping = true;
+		}
+		jobReady.notify_all();
+
+		for (thread &worker : workers)
+		{
+			worker.join();
+		} // end for
+	} // end destructor
+
+private:
+	ThreadPool() : job(nullptr), jobId(0), nextTask(0), taskCount(0), pendingTaskCount(0), freeWorkerCount(0), isStopping(false) {}
+
+	ThreadPool(const ThreadPool &) = delete;
+	ThreadPool &operator=(const ThreadPool &) = delete;
+
+	/// <summary>
+	/// Returns pool used by all threads.
+	/// </summary>
+	static ThreadPool &GetInstance()
+	{
+		static ThreadPool pool;
+		return pool;
+	} // end function GetInstance
+
+	/// <summary>
+	/// Waits for jobs and takes their tasks until pool is destroyed.
+	/// </summary>
+	void WorkerLoop()
+	{
+		unique_lock<mutex> lock(jobMutex);
+		UInt32 doneJobId = 0;
+		while (true)
+		{
+			jobReady.wait(lock, [&] { return isStopping || (job != nullptr && jobId != doneJobId && freeWorkerCount != 0); });
+			if (isStopping) return;
+
+			doneJobId = jobId;
+			--freeWorkerCount;
+			RunTasks(lock);
+		} // end while
+	} // end function WorkerLoop
+
+	/// <summary>
+	/// Runs tasks of current job until there are no more free ones.
+	/// </summary>
+	/// <param name="lock">Held lock of job state (it's released while task runs).</param>
+	void RunTasks(unique_lock<mutex> &lock)
+	{
+		const function<void(UInt32)> *currentJob = job;
+		while (nextTask < taskCount)
+		{
+			UInt32 task = nextTask++;
+
+			lock.unlock();
+			(*currentJob)(task);
+			lock.lock();
+
+			if (--pendingTaskCount == 0)
+			{
+				jobDone.notify_all();
+			} // end if
+		} // end while
+	} // end function RunTasks
+
+	vector<thread> workers;
+	mutex runMutex; // held by thread which runs its tasks on pool
+	mutex jobMutex; // guards job state below
+	condition_variable jobReady;
+	condition_variable jobDone;
+
+	const function<void(UInt32)> *job; // current job (null if there is none)
+	UInt32 jobId; // number of current job
+	UInt32 nextTask; // number of next task to run
+	UInt32 taskCount; // count of tasks of current job
+	UInt32 pendingTaskCount; // count of tasks which are not done yet
+	UInt32 freeWorkerCount; // count of workers which still may join current job
+	bool isStopping; // pool is being destroyed
+
+}; // end class ThreadPool
+
+#endif // !THREADPOOL_H